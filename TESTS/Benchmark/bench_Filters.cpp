@@ -0,0 +1,302 @@
+/**
+ * Project: Mbed-Shared-Components
+ * File: bench_Filters.cpp
+ * Author: Matthew Yu
+ * Created on: 10/17/26
+ * Last Modified: 10/17/26
+ * File Description: This program measures the per sample cost and the heap
+ * allocations of every filter in src/Filter on the host, across window sizes,
+ * input patterns and batch sizes.
+ *
+ * Output is CSV:
+ *     filter,window,pattern,batch,ns_per_sample,setup_allocs,run_allocs
+ *
+ * - window is 0 for filters whose cost does not depend on a window size.
+ * - batch 1 calls addSample and getResult for every sample; larger batches
+ *   call addSamples once per block and getResult once per block.
+ * - setup_allocs counts heap allocations made while constructing the filter,
+ *   run_allocs those made while filtering. run_allocs should always be 0.
+ * - Filter banks run 8 channels; their cost is per channel sample.
+ *
+ * Pass a substring as the first argument to only run matching filters, i.e.
+ * ./bench_Filters Median
+ */
+#include "Filter/Filter.h"
+#include "Filter/SmaFilter.h"
+#include "Filter/EmaFilter.h"
+#include "Filter/MedianFilter.h"
+#include "Filter/KalmanFilter.h"
+#include "Filter/KalmanFilterN.h"
+#include "Filter/BiquadCascadeFilter.h"
+#include "Filter/FirFilter.h"
+#include "Filter/FilterChain.h"
+#include "Filter/DecimatingFilter.h"
+#include "Filter/AggregatingFilter.h"
+#include "Filter/SlidingExtremaFilter.h"
+#include "Filter/VarianceFilter.h"
+#include "Filter/AlphaBetaFilter.h"
+#include "Filter/QuantileFilter.h"
+#include "Filter/SavitzkyGolayFilter.h"
+#include "Filter/GoertzelFilter.h"
+#include "Filter/SmaFilterQ.h"
+#include "Filter/EmaFilterQ.h"
+#include "Filter/KalmanFilterQ.h"
+#include "Filter/FilterBank.h"
+#include <chrono>
+#include <new>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define NUM_SAMPLES 65536
+#define NUM_PATTERNS 3
+#define NUM_BATCHES 3
+#define BANK_CHANNELS 8
+
+/** Number of heap allocations made so far. */
+static size_t allocs = 0;
+
+void * operator new(size_t size) {
+    ++allocs;
+    void * ptr = malloc(size ? size : 1);
+    if (ptr == nullptr) { throw std::bad_alloc(); }
+    return ptr;
+}
+
+void * operator new[](size_t size) { return operator new(size); }
+void operator delete(void * ptr) noexcept { free(ptr); }
+void operator delete[](void * ptr) noexcept { free(ptr); }
+void operator delete(void * ptr, size_t) noexcept { free(ptr); }
+void operator delete[](void * ptr, size_t) noexcept { free(ptr); }
+
+static const char * patternNames[NUM_PATTERNS] = {"ramp", "noise", "spikes"};
+static const size_t batches[NUM_BATCHES] = {1, 16, 256};
+
+/** Input traces, as floats and as Q15 sample codes. */
+static float samples[NUM_PATTERNS][NUM_SAMPLES];
+static int16_t codes[NUM_PATTERNS][NUM_SAMPLES];
+
+/** Keeps the optimizer from discarding filter output. */
+static volatile float sink;
+
+/** Only filters whose name contains this string are run, if set. */
+static const char * only = nullptr;
+
+/**
+ * Times a filter over every pattern and batch size and prints a CSV row for
+ * each.
+ *
+ * @param[in] name Filter name.
+ * @param[in] window Window size, or 0.
+ * @param[in] setupAllocs Allocations made constructing the filter.
+ * @param[in] count Number of steps per pattern.
+ * @param[in] perStep Number of samples each step consumes.
+ * @param[in] step Called as step(pattern, first, num) to filter num steps.
+ * @param[in] reset Called before each run to clear the filter.
+ */
+template <typename Step, typename Reset>
+static void run(
+    const char * name,
+    const unsigned window,
+    const size_t setupAllocs,
+    const size_t count,
+    const size_t perStep,
+    Step step,
+    Reset reset
+) {
+    if (only != nullptr && strstr(name, only) == nullptr) { return; }
+
+    for (size_t p = 0; p < NUM_PATTERNS; ++p) {
+        for (size_t b = 0; b < NUM_BATCHES; ++b) {
+            const size_t batch = batches[b];
+            reset();
+            const size_t before = allocs;
+            auto start = std::chrono::steady_clock::now();
+            for (size_t i = 0; i + batch <= count; i += batch) {
+                step(p, i, batch);
+            }
+            auto end = std::chrono::steady_clock::now();
+            const double ns = std::chrono::duration<double, std::nano>(end - start).count();
+            printf("%s,%u,%s,%zu,%.2f,%zu,%zu\n", name, window, patternNames[p], batch,
+                ns / (count / batch * batch * perStep), setupAllocs, allocs - before);
+        }
+    }
+}
+
+/** Runs a Filter through its virtual interface, as a Sensor would. */
+static void runFilter(
+    const char * name,
+    const unsigned window,
+    const size_t setupAllocs,
+    Filter & filter
+) {
+    run(name, window, setupAllocs, NUM_SAMPLES, 1,
+        [&filter](size_t p, size_t i, size_t n) {
+            if (n == 1) {
+                filter.addSample(samples[p][i]);
+            } else {
+                filter.addSamples(&samples[p][i], n);
+            }
+            sink = filter.getResult();
+        },
+        [&filter]() { filter.clear(); });
+}
+
+/** Runs a fixed point filter over the Q15 sample codes. */
+template <typename F>
+static void runFilterQ(const char * name, const unsigned window, F & filter) {
+    run(name, window, 0, NUM_SAMPLES, 1,
+        [&filter](size_t p, size_t i, size_t n) {
+            if (n == 1) {
+                filter.addSample(codes[p][i]);
+            } else {
+                filter.addSamples(&codes[p][i], n);
+            }
+            sink = filter.getResult();
+        },
+        [&filter]() { filter.clear(); });
+}
+
+/** Runs a filter bank, treating each pattern as interleaved channel ticks. */
+template <typename F>
+static void runBank(const char * name, const unsigned window, F & bank) {
+    run(name, window, 0, NUM_SAMPLES / BANK_CHANNELS, BANK_CHANNELS,
+        [&bank](size_t p, size_t i, size_t n) {
+            bank.addBlock(&samples[p][i * BANK_CHANNELS], n);
+            sink = bank.getResult(0);
+        },
+        [&bank]() { bank.clear(); });
+}
+
+/**
+ * Constructs a filter in static storage, so large windows stay off the stack,
+ * and counts the allocations its constructor makes into setup.
+ */
+#define MAKE(type, var, ...)                        \
+    setup = allocs;                                 \
+    static type var __VA_ARGS__;                    \
+    setup = allocs - setup;
+
+/** Filters whose cost depends on the window size. */
+template <uint16_t N>
+static void benchWindow(void) {
+    size_t setup;
+
+    MAKE(SmaFilter, sma, (N))
+    runFilter("SmaFilter", N, setup, sma);
+    sma.shutdown();
+
+    MAKE(SmaFilterN<N>, smaN)
+    runFilter("SmaFilterN", N, setup, smaN);
+
+    MAKE(MedianFilter, median, (N))
+    runFilter("MedianFilter", N, setup, median);
+    median.shutdown();
+
+    MAKE(MedianFilterN<N>, medianN)
+    runFilter("MedianFilterN", N, setup, medianN);
+
+    MAKE(FirFilter<N>, fir, (FirDesign::windowedSincLowPass<N>(100, 10000)))
+    runFilter("FirFilter", N, setup, fir);
+
+    MAKE(SavitzkyGolayFilter<N>, savitzkyGolay, (SavitzkyGolayDesign::fit<N, 2>((N - 1) / 2)))
+    runFilter("SavitzkyGolayFilter", N, setup, savitzkyGolay);
+
+    MAKE(DecimatingFilter, decimating, (N))
+    runFilter("DecimatingFilter", N, setup, decimating);
+
+    MAKE(AggregatingFilter, aggregating, (N))
+    runFilter("AggregatingFilter", N, setup, aggregating);
+
+    MAKE(SlidingExtremaFilter, extrema, (N, SlidingExtremaFilter::RANGE))
+    runFilter("SlidingExtremaFilter", N, setup, extrema);
+    extrema.shutdown();
+
+    MAKE(VarianceFilter, variance, (N))
+    runFilter("VarianceFilter", N, setup, variance);
+    variance.shutdown();
+
+    typedef FilterChain<MedianFilterN<N>, EmaFilter> Chain;
+    MAKE(Chain, chain, (MedianFilterN<N>(), EmaFilter(N, 0.2)))
+    runFilter("FilterChain<MedianFilterN,EmaFilter>", N, setup, chain);
+
+    typedef SmaFilterQ<Q15, N> SmaQ;
+    MAKE(SmaQ, smaQ)
+    runFilterQ("SmaFilterQ<Q15>", N, smaQ);
+
+    typedef SmaFilterBank<BANK_CHANNELS, N> SmaBank;
+    MAKE(SmaBank, smaBank)
+    runBank("SmaFilterBank", N, smaBank);
+}
+
+/** Filters whose cost does not depend on a window size. */
+static void benchFixed(void) {
+    size_t setup;
+
+    MAKE(Filter, passthrough)
+    runFilter("Filter", 0, setup, passthrough);
+
+    MAKE(EmaFilter, ema, (10, 0.2f))
+    runFilter("EmaFilter", 0, setup, ema);
+
+    MAKE(EmaVarianceFilter, emaVariance, (0.2f))
+    runFilter("EmaVarianceFilter", 0, setup, emaVariance);
+
+    MAKE(KalmanFilter, kalman, (10))
+    runFilter("KalmanFilter", 0, setup, kalman);
+
+    MAKE(KalmanFilter, kalmanFixed, (10, 10.0f, 225.0f, 25.0f, 0.15f,
+        KalmanFilter::STEADY_STATE))
+    runFilter("KalmanFilter (steady state)", 0, setup, kalmanFixed);
+
+    MAKE(AlphaBetaFilter, alphaBeta, (0.5f, 0.1f, 0.01f, 0.001f))
+    runFilter("AlphaBetaFilter", 0, setup, alphaBeta);
+
+    MAKE(QuantileFilter, quantile, (0.95f))
+    runFilter("QuantileFilter", 0, setup, quantile);
+
+    MAKE(GoertzelFilter<2>, goertzel, ({120.0f, 1000.0f}, 10000.0f, 200))
+    runFilter("GoertzelFilter<2>", 0, setup, goertzel);
+
+    MAKE(KalmanFilterN<2>, kalmanN, (0.001f, 10.0f, 225.0f, 25.0f, 0.15f))
+    runFilter("KalmanFilterN<2>", 0, setup, kalmanN);
+
+    MAKE(BiquadCascadeFilter<2>, biquad,
+        (BiquadDesign::butterworthLowPass<2>(100, 10000)))
+    runFilter("BiquadCascadeFilter<2>", 0, setup, biquad);
+
+    MAKE(EmaFilterQ<Q15>, emaQ, (0.2f))
+    runFilterQ("EmaFilterQ<Q15>", 0, emaQ);
+
+    MAKE(KalmanFilterQ<Q15>, kalmanQ, (10.0f, 225.0f, 25.0f, 0.15f))
+    runFilterQ("KalmanFilterQ<Q15>", 0, kalmanQ);
+
+    MAKE(EmaFilterBank<BANK_CHANNELS>, emaBank, (0.2f))
+    runBank("EmaFilterBank", 0, emaBank);
+
+    MAKE(KalmanFilterBank<BANK_CHANNELS>, kalmanBank)
+    runBank("KalmanFilterBank", 0, kalmanBank);
+}
+
+int main(int argc, char ** argv) {
+    if (argc > 1) { only = argv[1]; }
+
+    uint32_t seed = 1;
+    for (int i = 0; i < NUM_SAMPLES; i++) {
+        seed = seed * 1103515245 + 12345;
+        samples[0][i] = i * 0.001;
+        samples[1][i] = 12.0 + ((seed >> 16) % 1000) / 1000.0;
+        samples[2][i] = (i % 50 == 0) ? 100.0 : 12.0;
+        for (int p = 0; p < NUM_PATTERNS; p++) {
+            codes[p][i] = (int16_t) (samples[p][i] * 256);
+        }
+    }
+
+    printf("filter,window,pattern,batch,ns_per_sample,setup_allocs,run_allocs\n");
+    benchFixed();
+    benchWindow<8>();
+    benchWindow<64>();
+    benchWindow<512>();
+    benchWindow<4096>();
+    return 0;
+}
@@ -0,0 +1,65 @@
+/**
+ * Project: Mbed-Shared-Components
+ * File: bench_FirFilter.cpp
+ * Author: Matthew Yu
+ * Created on: 10/17/26
+ * Last Modified: 10/17/26
+ * File Description: This program compares the per sample cost of FirFilter
+ * against SmaFilter and SmaFilterN at equal window lengths on the host. Output
+ * is CSV: filter,window,ns_per_sample.
+ */
+#include "Filter/FirFilter.h"
+#include "Filter/SmaFilter.h"
+#include <chrono>
+#include <stdio.h>
+
+#define NUM_SAMPLES 1000000
+
+/** Input trace, a noisy ramp. */
+static float samples[NUM_SAMPLES];
+
+/** Keeps the optimizer from discarding filter output. */
+static volatile float sink;
+
+/**
+ * Returns the average time, in nanoseconds, to add a sample and read the
+ * result.
+ */
+static double timeFilter(Filter & filter) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < NUM_SAMPLES; i++) {
+        filter.addSample(samples[i]);
+        sink = filter.getResult();
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / NUM_SAMPLES;
+}
+
+template <uint16_t N>
+static void benchWindow(void) {
+    SmaFilter sma(N);
+    static SmaFilterN<N> smaN;
+    static FirFilter<N> firAverage(FirDesign::movingAverage<N>());
+    static FirFilter<N> firLowPass(FirDesign::windowedSincLowPass<N>(100, 10000));
+
+    printf("SmaFilter,%u,%.2f\n", N, timeFilter(sma));
+    printf("SmaFilterN,%u,%.2f\n", N, timeFilter(smaN));
+    printf("FirFilter (moving average),%u,%.2f\n", N, timeFilter(firAverage));
+    printf("FirFilter (windowed sinc),%u,%.2f\n", N, timeFilter(firLowPass));
+    sma.shutdown();
+}
+
+int main(void) {
+    uint32_t seed = 1;
+    for (int i = 0; i < NUM_SAMPLES; i++) {
+        seed = seed * 1103515245 + 12345;
+        samples[i] = i * 0.001 + ((seed >> 16) % 100) / 100.0;
+    }
+
+    printf("filter,window,ns_per_sample\n");
+    benchWindow<8>();
+    benchWindow<32>();
+    benchWindow<128>();
+    benchWindow<512>();
+    return 0;
+}
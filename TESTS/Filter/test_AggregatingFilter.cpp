@@ -0,0 +1,117 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "../dep/doctest.h"
+#include "Filter/AggregatingFilter.h"
+
+TEST_CASE("Testing the aggregating filter.") {
+    AggregatingFilter f = AggregatingFilter(4);
+
+    SUBCASE("Read while empty.") {
+        CHECK(f.getResult() == 0);
+        CHECK(f.getSummary().count == 0);
+        CHECK_FALSE(f.isOutputReady());
+        CHECK_FALSE(f.closeBlock());
+    }
+
+    SUBCASE("One summary per block.") {
+        float samples[4] = {3, -1, 7, 2};
+        for (int i = 0; i < 3; i++) {
+            f.addSample(samples[i]);
+            CHECK_FALSE(f.isOutputReady());
+        }
+        f.addSample(samples[3]);
+        CHECK(f.isOutputReady());
+
+        BlockSummary summary = f.readOutput();
+        CHECK_FALSE(f.isOutputReady());
+        CHECK(summary.min == -1);
+        CHECK(summary.max == 7);
+        CHECK(summary.mean == 2.75);
+        CHECK(summary.last == 2);
+        CHECK(summary.count == 4);
+        CHECK(f.getResult() == 2.75);
+
+        /* A new block does not see the extremes of the last one. */
+        float next[4] = {5, 5, 6, 5};
+        f.addSamples(next, 4);
+        summary = f.getSummary();
+        CHECK(summary.min == 5);
+        CHECK(summary.max == 6);
+        CHECK(summary.last == 5);
+    }
+
+    SUBCASE("Spikes survive.") {
+        AggregatingFilter g = AggregatingFilter(100);
+        float samples[100];
+        for (int i = 0; i < 100; i++) { samples[i] = 12; }
+        samples[37] = 80;
+        g.addSamples(samples, 100);
+        CHECK(g.getSummary().max == 80);
+        CHECK(g.getSummary().min == 12);
+        CHECK(g.getResult() == doctest::Approx(12.68));
+    }
+
+    SUBCASE("Bursts straddling blocks.") {
+        float samples[10] = {1, 2, 3, 4, 8, 6, 7, 5, 9, 0};
+        BlockSummary outputs[3];
+        CHECK(f.aggregate(samples, 6, outputs) == 1);
+        CHECK(outputs[0].min == 1);
+        CHECK(outputs[0].max == 4);
+        CHECK(outputs[0].last == 4);
+        CHECK(f.aggregate(samples + 6, 4, outputs) == 1);
+        CHECK(outputs[0].min == 5);
+        CHECK(outputs[0].max == 8);
+        CHECK(outputs[0].mean == 6.5);
+        CHECK(outputs[0].last == 5);
+
+        /* Sample by sample gives the same summaries as a burst. */
+        AggregatingFilter g = AggregatingFilter(4);
+        for (int i = 0; i < 8; i++) { g.addSample(samples[i]); }
+        CHECK(g.getSummary().min == outputs[0].min);
+        CHECK(g.getSummary().max == outputs[0].max);
+        CHECK(g.getSummary().mean == outputs[0].mean);
+        CHECK(g.getSummary().last == outputs[0].last);
+    }
+
+    SUBCASE("Closing a block early.") {
+        f.addSample(4);
+        f.addSample(-2);
+        CHECK(f.closeBlock());
+        CHECK(f.isOutputReady());
+        CHECK(f.getSummary().count == 2);
+        CHECK(f.getSummary().mean == 1);
+        CHECK(f.getSummary().min == -2);
+        CHECK_FALSE(f.closeBlock());
+
+        /* The next block starts from scratch. */
+        f.addSample(9);
+        CHECK(f.closeBlock());
+        CHECK(f.getSummary().min == 9);
+        CHECK(f.getSummary().count == 1);
+    }
+
+    SUBCASE("Packing into a message payload.") {
+        float samples[4] = {11.5, 12.25, 80.0, 12.0};
+        f.addSamples(samples, 4);
+        const uint64_t packed = f.getSummary().pack(0.01f, 0.0f);
+        BlockSummary summary = BlockSummary::unpack(packed, 0.01f, 0.0f);
+        CHECK(summary.count == 4);
+        CHECK(summary.min == doctest::Approx(11.5).epsilon(1e-4));
+        CHECK(summary.max == doctest::Approx(80.0).epsilon(1e-4));
+        CHECK(summary.mean == doctest::Approx(28.94).epsilon(1e-4));
+        CHECK(summary.last == doctest::Approx(12.0).epsilon(1e-4));
+
+        /* Out of range values and counts saturate. */
+        BlockSummary wide = {-5.0f, 1000.0f, 0.0f, 0.0f, 1000};
+        summary = BlockSummary::unpack(wide.pack(0.01f, 0.0f), 0.01f, 0.0f);
+        CHECK(summary.min == 0);
+        CHECK(summary.max == doctest::Approx(163.83).epsilon(1e-4));
+        CHECK(summary.count == 255);
+
+        /* An offset moves the representable range. */
+        BlockSummary negative = {-40.0f, 10.0f, -15.0f, 0.0f, 8};
+        summary = BlockSummary::unpack(negative.pack(0.1f, -50.0f), 0.1f, -50.0f);
+        CHECK(summary.min == doctest::Approx(-40.0).epsilon(1e-4));
+        CHECK(summary.max == doctest::Approx(10.0).epsilon(1e-4));
+        CHECK(summary.mean == doctest::Approx(-15.0).epsilon(1e-4));
+    }
+}
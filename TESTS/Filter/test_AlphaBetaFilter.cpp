@@ -0,0 +1,134 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "../dep/doctest.h"
+#include "Filter/AlphaBetaFilter.h"
+
+TEST_CASE("Testing the alpha beta filter.") {
+    AlphaBetaFilter f = AlphaBetaFilter(0.5, AlphaBetaFilter::benedictBordnerBeta(0.5), 0, 0.1);
+
+    SUBCASE("Read while empty.") {
+        CHECK(f.getResult() == 0);
+        CHECK(f.getRate() == 0);
+    }
+
+    SUBCASE("The first sample seeds the position.") {
+        f.addSample(12.0);
+        CHECK(f.getResult() == doctest::Approx(12.0));
+        CHECK(f.getRate() == 0);
+    }
+
+    SUBCASE("Tracks a ramp and its rate.") {
+        /* 3 units per second, sampled every 0.1 s. */
+        for (int i = 0; i < 200; i++) { f.addSample(0.3 * i); }
+        CHECK(f.getResult() == doctest::Approx(0.3 * 199).epsilon(1e-3));
+        CHECK(f.getRate() == doctest::Approx(3.0).epsilon(1e-3));
+        CHECK(f.getAcceleration() == 0);
+    }
+
+    SUBCASE("Per sample time steps.") {
+        /* Uneven intervals along the same 3 units per second ramp. */
+        const float steps[4] = {0.05, 0.1, 0.2, 0.15};
+        float t = 0;
+        f.addSample(0, 0.1);
+        for (int i = 0; i < 200; i++) {
+            t += steps[i % 4];
+            f.addSample(3.0 * t, steps[i % 4]);
+        }
+        CHECK(f.getResult() == doctest::Approx(3.0 * t).epsilon(1e-3));
+        CHECK(f.getRate() == doctest::Approx(3.0).epsilon(1e-3));
+    }
+
+    SUBCASE("Batch paths match single samples.") {
+        AlphaBetaFilter g = AlphaBetaFilter(0.5, 0.1, 0, 0.1);
+        AlphaBetaFilter h = AlphaBetaFilter(0.5, 0.1, 0, 0.1);
+        float samples[64];
+        float results[64];
+        for (int i = 0; i < 64; i++) { samples[i] = (i % 7) * 1.5; }
+        g.filterSamples(samples, results, 64);
+        for (int i = 0; i < 64; i++) {
+            h.addSample(samples[i]);
+            CHECK(results[i] == doctest::Approx(h.getResult()));
+        }
+        CHECK(g.getRate() == doctest::Approx(h.getRate()));
+    }
+
+    SUBCASE("Clear.") {
+        f.addSample(5.0);
+        f.addSample(6.0);
+        f.clear();
+        CHECK(f.getResult() == 0);
+        CHECK(f.getRate() == 0);
+        f.addSample(20.0);
+        CHECK(f.getResult() == doctest::Approx(20.0));
+    }
+
+    SUBCASE("Snapshot round trip.") {
+        for (int i = 0; i < 20; i++) { f.addSample(0.3 * i); }
+        uint8_t buffer[32];
+        size_t len = f.serialize(buffer, sizeof(buffer));
+        CHECK(len > 0);
+        AlphaBetaFilter g = AlphaBetaFilter(0.5, AlphaBetaFilter::benedictBordnerBeta(0.5), 0, 0.1);
+        CHECK(g.deserialize(buffer, len));
+        f.addSample(6.0);
+        g.addSample(6.0);
+        CHECK(g.getResult() == doctest::Approx(f.getResult()));
+        CHECK(g.getRate() == doctest::Approx(f.getRate()));
+    }
+}
+
+TEST_CASE("Testing the alpha beta gain relations.") {
+    CHECK(AlphaBetaFilter::benedictBordnerBeta(0.5) == doctest::Approx(1.0 / 6));
+    /* theta = 0.5 gives alpha = 0.75 and beta = 0.25. */
+    CHECK(AlphaBetaFilter::criticallyDampedBeta(0.75) == doctest::Approx(0.25));
+    CHECK(AlphaBetaFilter::criticallyDampedBeta(1.0) == doctest::Approx(1.0));
+
+    /* After a step, the critically damped error crosses zero once and then
+       decays, while the Benedict-Bordner error rings around it. */
+    AlphaBetaFilter critical = AlphaBetaFilter(0.5, AlphaBetaFilter::criticallyDampedBeta(0.5));
+    AlphaBetaFilter benedict = AlphaBetaFilter(0.5, AlphaBetaFilter::benedictBordnerBeta(0.5));
+    critical.addSample(0);
+    benedict.addSample(0);
+    float criticalErr = -1;
+    float benedictErr = -1;
+    int criticalCrossings = 0;
+    int benedictCrossings = 0;
+    for (int i = 0; i < 40; i++) {
+        critical.addSample(1);
+        benedict.addSample(1);
+        const float nextCritical = critical.getResult() - 1;
+        const float nextBenedict = benedict.getResult() - 1;
+        if (nextCritical * criticalErr < 0) { ++criticalCrossings; }
+        if (nextBenedict * benedictErr < 0) { ++benedictCrossings; }
+        criticalErr = nextCritical;
+        benedictErr = nextBenedict;
+    }
+    CHECK(criticalCrossings == 1);
+    CHECK(benedictCrossings > 2);
+    CHECK(critical.getResult() == doctest::Approx(1.0));
+}
+
+TEST_CASE("Testing the alpha beta gamma filter.") {
+    AlphaBetaFilter f = AlphaBetaFilter(0.5, 0.4, 0.1, 0.1);
+
+    SUBCASE("Tracks a parabola and its acceleration.") {
+        /* x = t^2, so v = 2t and a = 2. */
+        float t = 0;
+        for (int i = 0; i < 300; i++) {
+            t = 0.1 * i;
+            f.addSample(t * t);
+        }
+        CHECK(f.getResult() == doctest::Approx(t * t).epsilon(1e-3));
+        CHECK(f.getRate() == doctest::Approx(2 * t).epsilon(1e-2));
+        CHECK(f.getAcceleration() == doctest::Approx(2.0).epsilon(1e-2));
+    }
+
+    SUBCASE("Without gamma a ramp in rate lags.") {
+        AlphaBetaFilter g = AlphaBetaFilter(0.5, 0.4, 0, 0.1);
+        float t = 0;
+        for (int i = 0; i < 300; i++) {
+            t = 0.1 * i;
+            g.addSample(t * t);
+        }
+        CHECK(g.getResult() < t * t);
+        CHECK(g.getAcceleration() == 0);
+    }
+}
@@ -0,0 +1,89 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "../dep/doctest.h"
+#include "Filter/BiquadCascadeFilter.h"
+#include <cmath>
+
+#define SAMPLE_RATE 10000.0
+
+/** Measures the steady state amplitude of a unit sine through a filter. */
+template <size_t Sections>
+static float measureGain(BiquadCascadeFilter<Sections> & f, const double frequency) {
+    f.clear();
+    float peak = 0;
+    for (int i = 0; i < 20000; i++) {
+        float out = 0;
+        float in = std::sin(2.0 * M_PI * frequency * i / SAMPLE_RATE);
+        f.filterSamples(&in, &out, 1);
+        if (i > 15000) { peak = std::fmax(peak, std::fabs(out)); }
+    }
+    return peak;
+}
+
+TEST_CASE("Testing the constexpr math helpers.") {
+    constexpr double s = ConstexprMath::sin(1.0);
+    constexpr double c = ConstexprMath::cos(-7.5);
+    constexpr double t = ConstexprMath::tan(0.3);
+    constexpr double r = ConstexprMath::sqrt(2.0);
+    CHECK(s == doctest::Approx(std::sin(1.0)).epsilon(1e-12));
+    CHECK(c == doctest::Approx(std::cos(-7.5)).epsilon(1e-12));
+    CHECK(t == doctest::Approx(std::tan(0.3)).epsilon(1e-12));
+    CHECK(r == doctest::Approx(std::sqrt(2.0)).epsilon(1e-12));
+}
+
+TEST_CASE("Testing the biquad cascade filter.") {
+    SUBCASE("Butterworth low pass.") {
+        constexpr BiquadCascadeCoefficients<2> coeffs =
+            BiquadDesign::butterworthLowPass<2>(100, SAMPLE_RATE);
+        BiquadCascadeFilter<2> f(coeffs);
+        CHECK(f.getResult() == 0);
+
+        /* Unity DC gain. */
+        for (int i = 0; i < 5000; i++) { f.addSample(3.0); }
+        CHECK(f.getResult() == doctest::Approx(3.0).epsilon(1e-3));
+
+        CHECK(measureGain(f, 10) == doctest::Approx(1.0).epsilon(0.01));
+        CHECK(measureGain(f, 100) == doctest::Approx(std::sqrt(0.5)).epsilon(0.02));
+        /* Fourth order: -80 dB a decade above the cutoff. */
+        CHECK(measureGain(f, 1000) < 2e-4);
+    }
+
+    SUBCASE("Bessel low pass.") {
+        constexpr auto coeffs = BiquadDesign::besselLowPass<2>(100, SAMPLE_RATE);
+        BiquadCascadeFilter<2> f(coeffs);
+        CHECK(measureGain(f, 10) == doctest::Approx(1.0).epsilon(0.01));
+        CHECK(measureGain(f, 100) == doctest::Approx(std::sqrt(0.5)).epsilon(0.03));
+        CHECK(measureGain(f, 1000) < 1e-2);
+
+        /* No overshoot on a step. */
+        f.clear();
+        float peak = 0;
+        for (int i = 0; i < 2000; i++) {
+            f.addSample(1.0);
+            peak = std::fmax(peak, f.getResult());
+        }
+        CHECK(peak < 1.01);
+    }
+
+    SUBCASE("Notch rejects only the center frequency.") {
+        constexpr auto coeffs = BiquadDesign::cascade(
+            BiquadDesign::notch(1000, SAMPLE_RATE, 5),
+            BiquadDesign::notch(2000, SAMPLE_RATE, 5));
+        BiquadCascadeFilter<2> f(coeffs);
+        CHECK(measureGain(f, 1000) < 1e-3);
+        CHECK(measureGain(f, 2000) < 1e-3);
+        CHECK(measureGain(f, 50) == doctest::Approx(1.0).epsilon(0.01));
+    }
+
+    SUBCASE("Batch calls match single calls.") {
+        BiquadCascadeFilter<2> single(BiquadDesign::butterworthLowPass<2>(300, SAMPLE_RATE));
+        BiquadCascadeFilter<2> batch(BiquadDesign::butterworthLowPass<2>(300, SAMPLE_RATE));
+        float samples[20];
+        float results[20];
+        for (int i = 0; i < 20; i++) { samples[i] = (i%5 == 0) ? 100 : i*10.0; }
+        batch.filterSamples(samples, results, 20);
+        for (int i = 0; i < 20; i++) {
+            single.addSample(samples[i]);
+            CHECK(results[i] == single.getResult());
+        }
+    }
+}
@@ -0,0 +1,44 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "../dep/doctest.h"
+#include "Filter/DecimatingFilter.h"
+
+TEST_CASE("Testing the decimating filter.") {
+    DecimatingFilter f = DecimatingFilter(4);
+
+    SUBCASE("Read while empty.") {
+        CHECK(f.getResult() == 0);
+        CHECK_FALSE(f.isOutputReady());
+    }
+
+    SUBCASE("One output per block.") {
+        for (int i = 0; i < 3; i++) {
+            f.addSample(i);
+            CHECK_FALSE(f.isOutputReady());
+        }
+        f.addSample(3);
+        CHECK(f.isOutputReady());
+        CHECK(f.readOutput() == 1.5);
+        CHECK_FALSE(f.isOutputReady());
+        CHECK(f.getResult() == 1.5);
+
+        f.addSample(10);
+        CHECK_FALSE(f.isOutputReady());
+        CHECK(f.getResult() == 1.5);
+    }
+
+    SUBCASE("Bursts straddling blocks.") {
+        float samples[10] = {1, 1, 1, 1, 2, 2, 2, 2, 3, 3};
+        float outputs[3];
+        CHECK(f.decimate(samples, 6, outputs) == 1);
+        CHECK(outputs[0] == 1.0);
+        CHECK(f.decimate(samples + 6, 4, outputs) == 1);
+        CHECK(outputs[0] == 2.0);
+
+        f.clear();
+        f.addSamples(samples, 10);
+        CHECK(f.isOutputReady());
+        CHECK(f.getResult() == 2.0);
+        f.addSamples(samples + 8, 2);
+        CHECK(f.getResult() == 3.0);
+    }
+}
@@ -0,0 +1,31 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "../dep/doctest.h"
+#include "Filter/EmaFilter.h"
+
+TEST_CASE("Testing the EMA filter batch API.") {
+    EmaFilter single = EmaFilter(5, .2);
+    EmaFilter batch = EmaFilter(5, .2);
+    float samples[20];
+    // 20 samples, increasing linearly by 10, and then some noisy 100s every 5 cycles.
+    for (int i = 0; i < 20; i++) {
+        samples[i] = (i%5 == 0) ? 100 : i*10.0;
+    }
+
+    SUBCASE("addSamples matches addSample.") {
+        for (int i = 0; i < 20; i++) {
+            single.addSample(samples[i]);
+        }
+        batch.addSamples(samples, 8);
+        batch.addSamples(samples + 8, 12);
+        CHECK(batch.getResult() == doctest::Approx(single.getResult()));
+    }
+
+    SUBCASE("filterSamples reports the result after every sample.") {
+        float results[20];
+        batch.filterSamples(samples, results, 20);
+        for (int i = 0; i < 20; i++) {
+            single.addSample(samples[i]);
+            CHECK(results[i] == doctest::Approx(single.getResult()));
+        }
+    }
+}
@@ -0,0 +1,60 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "../dep/doctest.h"
+#include "Filter/EmaFilter.h"
+#include "Filter/EmaFilterQ.h"
+#include <cmath>
+
+TEST_CASE("Testing the fixed point EMA filter against the float EMA filter.") {
+    const float alphas[3] = {0.5f, 0.2f, 0.01f};
+    for (int a = 0; a < 3; a++) {
+        EmaFilterQ<Q15> q15(alphas[a]);
+        EmaFilterQ<Q31> q31(alphas[a]);
+        EmaFilter ref(5, fromQ<Q15>(toQ<Q15>(alphas[a])));
+        EmaFilter ref31(5, alphas[a]);
+
+        uint32_t seed = 7;
+        float maxErr15 = 0;
+        float maxErr31 = 0;
+        for (int i = 0; i < 2000; i++) {
+            seed = seed * 1103515245 + 12345;
+            int16_t code = (int16_t) (2048 + (int) ((seed >> 16) % 512) - 256);
+            if (i % 101 == 0) { code = 4095; }
+
+            q15.addSample(code);
+            q31.addSample(code);
+            ref.addSample(code);
+            ref31.addSample(code);
+
+            maxErr15 = std::fmax(maxErr15, std::fabs(q15.getResult() - ref.getResult()));
+            maxErr31 = std::fmax(maxErr31, std::fabs(q31.getResult() - ref31.getResult()));
+        }
+        /* Within rounding of the output code; no dead band at small alpha. */
+        CHECK(maxErr15 <= 0.51f);
+        CHECK(maxErr31 <= 0.51f);
+    }
+}
+
+TEST_CASE("Testing the fixed point EMA filter settles on a constant input.") {
+    /* Without extra state bits, updates under half a code round to zero and
+       a small alpha stalls short of the input. */
+    EmaFilterQ<Q15> q15(0.01f);
+    EmaFilterQ<Q31> q31(0.01f);
+    for (int i = 0; i < 3000; i++) {
+        q15.addSample(1000);
+        q31.addSample(1000);
+    }
+    CHECK(q15.getResult() == 1000);
+    CHECK(q31.getResult() == 1000);
+}
+
+TEST_CASE("Testing the fixed point EMA filter saturation.") {
+    EmaFilterQ<Q15> f(1.0f);
+    int16_t block[3] = {32767, 32767, 32767};
+    f.addSamples(block, 3);
+    CHECK(f.getResult() == 32767);
+    f.addSample(-32768);
+    /* The error term saturates rather than wrapping positive. */
+    CHECK(f.getResult() < -32700);
+    f.clear();
+    CHECK(f.getResult() == 0);
+}
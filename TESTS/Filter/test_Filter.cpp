@@ -23,5 +23,15 @@ TEST_CASE("Testing the passthrough filter.") {
         CHECK(f.getResult() == 10.0);
     }
 
+    SUBCASE("Read after a batch of writes.") {
+        float samples[3] = {1.0, 2.0, 3.0};
+        float results[3];
+        f.filterSamples(samples, results, 3);
+        CHECK(results[0] == 1.0);
+        CHECK(results[2] == 3.0);
+        f.addSamples(samples, 2);
+        CHECK(f.getResult() == 2.0);
+    }
+
     f.shutdown();
 }
\ No newline at end of file
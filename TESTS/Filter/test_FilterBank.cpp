@@ -0,0 +1,76 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "../dep/doctest.h"
+#include "Filter/FilterBank.h"
+#include "Filter/SmaFilter.h"
+#include "Filter/EmaFilter.h"
+#include "Filter/KalmanFilter.h"
+
+#define CHANNELS 24
+#define TICKS 40
+
+/** Fills a tick major block with a different noisy ramp per channel. */
+static void makeBlock(float * block) {
+    uint32_t seed = 11;
+    for (int t = 0; t < TICKS; t++) {
+        for (int c = 0; c < CHANNELS; c++) {
+            seed = seed * 1103515245 + 12345;
+            block[t * CHANNELS + c] = c * 5.0 + t * 0.5 + ((seed >> 16) % 100) / 10.0;
+        }
+    }
+}
+
+TEST_CASE("Testing the SMA filter bank.") {
+    static SmaFilterBank<CHANNELS, 5> bank;
+    static float block[TICKS * CHANNELS];
+    makeBlock(block);
+
+    float results[CHANNELS];
+    bank.getResults(results);
+    CHECK(results[0] == 0);
+
+    bank.addBlock(block, 3);
+    bank.addBlock(block + 3 * CHANNELS, TICKS - 3);
+    bank.getResults(results);
+    for (int c = 0; c < CHANNELS; c++) {
+        SmaFilterN<5> ref;
+        for (int t = 0; t < TICKS; t++) { ref.addSample(block[t * CHANNELS + c]); }
+        CHECK(results[c] == doctest::Approx(ref.getResult()));
+        CHECK(bank.getResult(c) == doctest::Approx(ref.getResult()));
+    }
+
+    bank.clear();
+    CHECK(bank.getResult(3) == 0);
+}
+
+TEST_CASE("Testing the EMA filter bank.") {
+    static EmaFilterBank<CHANNELS> bank(0.2);
+    static float block[TICKS * CHANNELS];
+    makeBlock(block);
+    bank.setAlpha(1, 0.7);
+
+    bank.addBlock(block, TICKS);
+    for (int c = 0; c < CHANNELS; c++) {
+        EmaFilter ref(5, (c == 1) ? 0.7 : 0.2);
+        for (int t = 0; t < TICKS; t++) { ref.addSample(block[t * CHANNELS + c]); }
+        CHECK(bank.getResult(c) == doctest::Approx(ref.getResult()));
+    }
+}
+
+TEST_CASE("Testing the Kalman filter bank.") {
+    static KalmanFilterBank<CHANNELS> bank;
+    static float block[TICKS * CHANNELS];
+    makeBlock(block);
+    CHECK(bank.getResult(0) == 10.0);
+
+    bank.addBlock(block, TICKS);
+    float results[CHANNELS];
+    bank.getResults(results);
+    for (int c = 0; c < CHANNELS; c++) {
+        KalmanFilter ref(5);
+        for (int t = 0; t < TICKS; t++) { ref.addSample(block[t * CHANNELS + c]); }
+        CHECK(results[c] == doctest::Approx(ref.getResult()));
+    }
+
+    bank.clear();
+    CHECK(bank.getResult(5) == 10.0);
+}
@@ -0,0 +1,53 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "../dep/doctest.h"
+#include "Filter/FilterChain.h"
+#include "Filter/MedianFilter.h"
+#include "Filter/EmaFilter.h"
+#include "Filter/SmaFilter.h"
+
+TEST_CASE("Testing the filter chain.") {
+    FilterChain<MedianFilterN<5>, EmaFilter> f(MedianFilterN<5>(), EmaFilter(5, 0.5));
+    MedianFilterN<5> median;
+    EmaFilter ema(5, 0.5);
+
+    SUBCASE("Read while empty.") {
+        CHECK(f.getResult() == 0);
+    }
+
+    SUBCASE("Each stage feeds the next.") {
+        for (int i = 0; i < 20; i++) {
+            float sample = (i%5 == 0) ? 100 : i*10.0;
+            f.addSample(sample);
+            median.addSample(sample);
+            ema.addSample(median.getResult());
+            CHECK(f.getResult() == ema.getResult());
+        }
+        CHECK(f.getStage<1>().getResult() == f.getResult());
+        CHECK(f.getStage<0>().getResult() == median.getResult());
+    }
+
+    SUBCASE("Batch calls match single calls.") {
+        float samples[20];
+        float results[20];
+        for (int i = 0; i < 20; i++) { samples[i] = (i%5 == 0) ? 100 : i*10.0; }
+        f.filterSamples(samples, results, 20);
+        for (int i = 0; i < 20; i++) {
+            median.addSample(samples[i]);
+            ema.addSample(median.getResult());
+            CHECK(results[i] == ema.getResult());
+        }
+        f.clear();
+        CHECK(f.getResult() == 0);
+        f.addSamples(samples, 20);
+        CHECK(f.getResult() == ema.getResult());
+    }
+
+    SUBCASE("A chain is usable through the Filter interface.") {
+        FilterChain<SmaFilter> owner(SmaFilter(2));
+        Filter * base = &owner;
+        base->addSample(2.0);
+        base->addSample(4.0);
+        CHECK(base->getResult() == 3.0);
+        base->shutdown();
+    }
+}
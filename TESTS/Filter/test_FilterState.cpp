@@ -0,0 +1,277 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "../dep/doctest.h"
+#include "Filter/Filter.h"
+#include "Filter/SmaFilter.h"
+#include "Filter/EmaFilter.h"
+#include "Filter/MedianFilter.h"
+#include "Filter/KalmanFilter.h"
+#include "Filter/FilterChain.h"
+#include "Filter/KalmanFilterN.h"
+#include "Filter/BiquadCascadeFilter.h"
+#include "Filter/FirFilter.h"
+#include "Filter/SavitzkyGolayFilter.h"
+#include "Filter/DecimatingFilter.h"
+#include "Filter/SlidingExtremaFilter.h"
+#include "Filter/VarianceFilter.h"
+#include "Filter/GoertzelFilter.h"
+#include "Filter/AggregatingFilter.h"
+
+static float samples[20] = {
+    3, 8, 1, 9, 4, 4, 7, 2, 6, 5, 100, 6, 5, 7, 3, 8, 2, 6, 4, 5
+};
+
+/**
+ * Snapshots a filter fed with the first half of the samples, restores it into
+ * a fresh filter, and checks both behave the same on the second half.
+ */
+template <typename F>
+void checkRoundTrip(F & original, F & restored) {
+    uint8_t buffer[256];
+    original.addSamples(samples, 10);
+    size_t size = original.serialize(nullptr, 0);
+    CHECK(size > FILTER_STATE_HEADER_SIZE);
+    CHECK(original.serialize(buffer, sizeof(buffer)) == size);
+    CHECK(original.serialize(buffer, size - 1) == 0);
+    CHECK(restored.deserialize(buffer, size));
+    CHECK(restored.getResult() == doctest::Approx(original.getResult()));
+    for (int i = 10; i < 20; i++) {
+        original.addSample(samples[i]);
+        restored.addSample(samples[i]);
+        CHECK(restored.getResult() == doctest::Approx(original.getResult()));
+    }
+}
+
+TEST_CASE("Testing the filter state format.") {
+    uint8_t buffer[16];
+
+    SUBCASE("Header.") {
+        EmaFilter f(5, 0.5);
+        f.addSample(2.5);
+        CHECK(f.serialize(buffer, sizeof(buffer)) == FILTER_STATE_HEADER_SIZE + sizeof(float));
+        CHECK(buffer[0] == FilterState::EMA);
+        CHECK(buffer[1] == FILTER_STATE_VERSION);
+        CHECK(FilterState::size(buffer, sizeof(buffer)) == 8);
+        CHECK(FilterState::size(buffer, 7) == 0);
+    }
+
+    SUBCASE("Rejected snapshots leave the filter unchanged.") {
+        Filter f;
+        EmaFilter ema(5, 0.5);
+        ema.addSample(4.0);
+        size_t size = ema.serialize(buffer, sizeof(buffer));
+
+        f.addSample(1.0);
+        CHECK_FALSE(f.deserialize(buffer, size));
+        CHECK(f.getResult() == 1.0);
+
+        EmaFilter other(5, 0.5);
+        CHECK_FALSE(other.deserialize(buffer, size - 1));
+        buffer[1] = FILTER_STATE_VERSION + 1;
+        CHECK_FALSE(other.deserialize(buffer, size));
+        CHECK(other.getResult() == 0);
+        CHECK_FALSE(other.deserialize(nullptr, 0));
+    }
+
+    SUBCASE("The base filter has no snapshot format.") {
+        Filter f;
+        f.addSample(2.5);
+        CHECK(f.serialize(nullptr, 0) == 0);
+        CHECK(f.serialize(buffer, sizeof(buffer)) == 0);
+
+        EmaFilter ema(5, 0.5);
+        ema.addSample(4.0);
+        CHECK_FALSE(f.deserialize(buffer, ema.serialize(buffer, sizeof(buffer))));
+        CHECK(f.getResult() == 2.5);
+    }
+
+    SUBCASE("Foreign tags are rejected.") {
+        uint8_t snapshot[128];
+        KalmanFilterN<2> kalman(0.01, 10.0, 225, 25, 0.15);
+        kalman.addSamples(samples, 10);
+        size_t size = kalman.serialize(snapshot, sizeof(snapshot));
+        REQUIRE(size > 0);
+
+        FirFilter<8> fir(FirDesign::movingAverage<8>());
+        fir.addSamples(samples, 3);
+        float result = fir.getResult();
+        CHECK_FALSE(fir.deserialize(snapshot, size));
+        CHECK(fir.getResult() == result);
+
+        BiquadCascadeFilter<2> biquad(BiquadDesign::butterworthLowPass<2>(100, 1000));
+        biquad.addSamples(samples, 3);
+        result = biquad.getResult();
+        CHECK_FALSE(biquad.deserialize(snapshot, size));
+        CHECK(biquad.getResult() == result);
+
+        VarianceFilter variance(4);
+        variance.addSamples(samples, 3);
+        result = variance.getResult();
+        CHECK_FALSE(variance.deserialize(snapshot, size));
+        CHECK(variance.getResult() == result);
+        variance.shutdown();
+
+        /* Same tag, but a different number of taps. */
+        FirFilter<4> shorter(FirDesign::movingAverage<4>());
+        shorter.addSamples(samples, 10);
+        result = fir.getResult();
+        CHECK_FALSE(fir.deserialize(snapshot, shorter.serialize(snapshot, sizeof(snapshot))));
+        CHECK(fir.getResult() == result);
+    }
+}
+
+TEST_CASE("Testing filter snapshot round trips.") {
+    SUBCASE("SMA.") {
+        SmaFilter a(4), b(4);
+        checkRoundTrip(a, b);
+        a.shutdown();
+        b.shutdown();
+    }
+
+    SUBCASE("SMA restored into a smaller window keeps the newest samples.") {
+        SmaFilterN<8> a;
+        SmaFilterN<2> b;
+        uint8_t buffer[64];
+        a.addSamples(samples, 10);
+        CHECK(b.deserialize(buffer, a.serialize(buffer, sizeof(buffer))));
+        CHECK(b.getResult() == doctest::Approx((samples[8] + samples[9]) / 2));
+    }
+
+    SUBCASE("EMA.") {
+        EmaFilter a(5, 0.3), b(5, 0.3);
+        checkRoundTrip(a, b);
+    }
+
+    SUBCASE("Median.") {
+        MedianFilter a(5), b(5);
+        checkRoundTrip(a, b);
+        a.shutdown();
+        b.shutdown();
+        MedianFilterN<4> c, d;
+        checkRoundTrip(c, d);
+    }
+
+    SUBCASE("Kalman.") {
+        KalmanFilter a(5, 10.0, 225, 25, 0.15, KalmanFilter::AUTO);
+        KalmanFilter b(5, 10.0, 225, 25, 0.15, KalmanFilter::AUTO);
+        checkRoundTrip(a, b);
+        CHECK(b.isGainFixed() == a.isGainFixed());
+        CHECK(b.getGain() == a.getGain());
+    }
+
+    SUBCASE("Kalman N.") {
+        KalmanFilterN<2> a(0.01, 10.0, 225, 25, 0.15);
+        KalmanFilterN<2> b(0.01, 10.0, 225, 25, 0.15);
+        checkRoundTrip(a, b);
+        CHECK(b.getState()(1, 0) == a.getState()(1, 0));
+    }
+
+    SUBCASE("Biquad.") {
+        constexpr BiquadCascadeCoefficients<2> coeffs =
+            BiquadDesign::butterworthLowPass<2>(100, 1000);
+        BiquadCascadeFilter<2> a(coeffs), b(coeffs);
+        checkRoundTrip(a, b);
+    }
+
+    SUBCASE("FIR.") {
+        FirFilter<8> a(FirDesign::windowedSincLowPass<8>(100, 1000));
+        FirFilter<8> b(FirDesign::windowedSincLowPass<8>(100, 1000));
+        checkRoundTrip(a, b);
+    }
+
+    SUBCASE("Savitzky-Golay.") {
+        SavitzkyGolayFilter<7> a(SavitzkyGolayDesign::fit<7, 2>(3), 0.01);
+        SavitzkyGolayFilter<7> b(SavitzkyGolayDesign::fit<7, 2>(3), 0.01);
+        checkRoundTrip(a, b);
+        CHECK(b.getDerivative() == doctest::Approx(a.getDerivative()));
+    }
+
+    SUBCASE("Decimating.") {
+        DecimatingFilter a(3), b(3);
+        checkRoundTrip(a, b);
+        CHECK(b.isOutputReady() == a.isOutputReady());
+
+        /* A partial block from a larger ratio does not fit. */
+        DecimatingFilter c(2);
+        uint8_t buffer[64];
+        CHECK_FALSE(c.deserialize(buffer, a.serialize(buffer, sizeof(buffer))));
+    }
+
+    SUBCASE("Sliding extrema.") {
+        SlidingExtremaFilter a(5, SlidingExtremaFilter::RANGE);
+        SlidingExtremaFilter b(5, SlidingExtremaFilter::RANGE);
+        checkRoundTrip(a, b);
+        CHECK(b.getMin() == a.getMin());
+        CHECK(b.getMax() == a.getMax());
+        a.shutdown();
+        b.shutdown();
+    }
+
+    SUBCASE("Sliding extrema restored into a smaller window expire stale entries.") {
+        SlidingExtremaFilter a(5, SlidingExtremaFilter::MIN);
+        SlidingExtremaFilter b(3, SlidingExtremaFilter::MIN);
+        const float window[5] = {1, 9, 9, 9, 9};
+        a.addSamples(window, 5);
+        CHECK(a.getMin() == 1);
+
+        uint8_t buffer[128];
+        CHECK(b.deserialize(buffer, a.serialize(buffer, sizeof(buffer))));
+        CHECK(b.getMin() == 9);
+        for (int i = 0; i < 10; i++) { b.addSample(50); }
+        CHECK(b.getMin() == 50);
+        a.shutdown();
+        b.shutdown();
+    }
+
+    SUBCASE("Variance.") {
+        VarianceFilter a(5), b(5);
+        checkRoundTrip(a, b);
+        CHECK(b.getMean() == doctest::Approx(a.getMean()));
+
+        /* A window longer than the filter's does not fit. */
+        VarianceFilter c(4);
+        uint8_t buffer[128];
+        CHECK_FALSE(c.deserialize(buffer, a.serialize(buffer, sizeof(buffer))));
+        a.shutdown();
+        b.shutdown();
+        c.shutdown();
+    }
+
+    SUBCASE("EMA variance.") {
+        EmaVarianceFilter a(0.3), b(0.3);
+        checkRoundTrip(a, b);
+        CHECK(b.getMean() == a.getMean());
+    }
+
+    SUBCASE("Goertzel.") {
+        GoertzelFilter<2> a({100, 250}, 1000, 4);
+        GoertzelFilter<2> b({100, 250}, 1000, 4);
+        checkRoundTrip(a, b);
+        CHECK(b.getMagnitude(1) == a.getMagnitude(1));
+    }
+
+    SUBCASE("Aggregating.") {
+        AggregatingFilter a(4), b(4);
+        checkRoundTrip(a, b);
+        b.closeBlock();
+        a.closeBlock();
+        CHECK(b.getSummary().min == a.getSummary().min);
+        CHECK(b.getSummary().max == a.getSummary().max);
+        CHECK(b.getSummary().count == a.getSummary().count);
+    }
+
+    SUBCASE("Chain.") {
+        FilterChain<MedianFilterN<3>, EmaFilter> a(MedianFilterN<3>(), EmaFilter(5, 0.5));
+        FilterChain<MedianFilterN<3>, EmaFilter> b(MedianFilterN<3>(), EmaFilter(5, 0.5));
+        checkRoundTrip(a, b);
+
+        /* A chain of different stages rejects the snapshot. */
+        FilterChain<MedianFilterN<3>, SmaFilterN<3>> c;
+        uint8_t buffer[64];
+        CHECK_FALSE(c.deserialize(buffer, a.serialize(buffer, sizeof(buffer))));
+
+        /* A stage without a snapshot format fails the whole chain. */
+        FilterChain<EmaFilter, Filter> d(EmaFilter(5, 0.5), Filter());
+        d.addSample(1.0);
+        CHECK(d.serialize(buffer, sizeof(buffer)) == 0);
+    }
+}
@@ -0,0 +1,78 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "../dep/doctest.h"
+#include "Filter/FirFilter.h"
+#include "Filter/SmaFilter.h"
+#include <cmath>
+
+#define SAMPLE_RATE 10000.0
+
+TEST_CASE("Testing the FIR filter.") {
+    SUBCASE("Read while empty.") {
+        FirFilter<5> f(FirDesign::movingAverage<5>());
+        CHECK(f.getResult() == 0);
+    }
+
+    SUBCASE("Moving average taps match the SMA filter once full.") {
+        FirFilter<5> f(FirDesign::movingAverage<5>());
+        SmaFilterN<5> sma;
+        for (int i = 0; i < 40; i++) {
+            float sample = (i%5 == 0) ? 100 : i*10.0;
+            f.addSample(sample);
+            sma.addSample(sample);
+            if (i >= 4) { CHECK(f.getResult() == doctest::Approx(sma.getResult())); }
+        }
+    }
+
+    SUBCASE("Windowed sinc low pass is linear phase with unity DC gain.") {
+        constexpr FirCoefficients<31> coeffs =
+            FirDesign::windowedSincLowPass<31>(200, SAMPLE_RATE);
+        float sum = 0;
+        for (int n = 0; n < 31; n++) {
+            CHECK(coeffs.tap[n] == doctest::Approx(coeffs.tap[30 - n]));
+            sum += coeffs.tap[n];
+        }
+        CHECK(sum == doctest::Approx(1.0));
+
+        FirFilter<31> f(coeffs);
+        for (int i = 0; i < 100; i++) { f.addSample(2.0); }
+        CHECK(f.getResult() == doctest::Approx(2.0));
+
+        /* A tone well into the stop band is attenuated. */
+        f.clear();
+        float peak = 0;
+        for (int i = 0; i < 1000; i++) {
+            f.addSample(std::sin(2.0 * M_PI * 2000 * i / SAMPLE_RATE));
+            if (i > 100) { peak = std::fmax(peak, std::fabs(f.getResult())); }
+        }
+        CHECK(peak < 0.01);
+    }
+
+    SUBCASE("Batch calls match single calls.") {
+        FirFilter<7> single(FirDesign::windowedSincLowPass<7>(1000, SAMPLE_RATE));
+        FirFilter<7> batch(FirDesign::windowedSincLowPass<7>(1000, SAMPLE_RATE));
+        float samples[20];
+        float results[20];
+        for (int i = 0; i < 20; i++) { samples[i] = (i%5 == 0) ? 100 : i*10.0; }
+        batch.filterSamples(samples, results, 20);
+        for (int i = 0; i < 20; i++) {
+            single.addSample(samples[i]);
+            CHECK(results[i] == single.getResult());
+        }
+        batch.clear();
+        batch.addSamples(samples, 20);
+        CHECK(batch.getResult() == single.getResult());
+    }
+
+    SUBCASE("The output is computed on read.") {
+        FirFilter<5> f(FirDesign::movingAverage<5>());
+        float samples[5] = {1, 2, 3, 4, 5};
+        f.addSample(10);
+        f.addSamples(samples, 5);
+        CHECK(f.getResult() == doctest::Approx(3.0));
+        CHECK(f.getResult() == doctest::Approx(3.0));
+        f.addSample(10);
+        CHECK(f.getResult() == doctest::Approx(4.8));
+        f.clear();
+        CHECK(f.getResult() == 0);
+    }
+}
@@ -0,0 +1,48 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "../dep/doctest.h"
+#include "Filter/FixedPoint.h"
+
+TEST_CASE("Testing the fixed point helpers.") {
+    SUBCASE("Saturate clamps to the destination range.") {
+        CHECK(saturate<int16_t>((int32_t) 40000) == 32767);
+        CHECK(saturate<int16_t>((int32_t) -40000) == -32768);
+        CHECK(saturate<int16_t>((int32_t) 1234) == 1234);
+        CHECK(saturate<int32_t>((int64_t) 1 << 40) == INT32_MAX);
+    }
+
+    SUBCASE("Round shift rounds half up.") {
+        CHECK(roundShift((int32_t) 5, 1) == 3);
+        CHECK(roundShift((int32_t) 4, 1) == 2);
+        CHECK(roundShift((int32_t) -5, 1) == -2);
+        CHECK(roundShift((int32_t) 7, 0) == 7);
+    }
+
+    SUBCASE("Float conversions round trip and saturate.") {
+        CHECK(toQ<Q15>(0.5f) == 16384);
+        CHECK(toQ<Q15>(-1.0f) == -32768);
+        CHECK(toQ<Q15>(1.0f) == 32767);
+        CHECK(toQ<Q31>(0.25f) == (1 << 29));
+        CHECK(fromQ<Q15>(toQ<Q15>(0.2f)) == doctest::Approx(0.2f).epsilon(1e-4));
+        CHECK(fromQ<Q31>(toQ<Q31>(-0.7f)) == doctest::Approx(-0.7f));
+    }
+
+    SUBCASE("Blending saturates instead of wrapping.") {
+        Q15::State state = INT32_MAX - 10;
+        state = blendQ<Q15>(state, 32767, toQ<Q15>(0.9f));
+        CHECK(state <= INT32_MAX);
+        CHECK(stateToSample<Q15>(state) == 32767);
+        Q31::State low = (Q31::State) INT32_MIN * ((Q31::State) 1 << Q31::STATE_SHIFT);
+        low = blendQ<Q31>(low, INT32_MIN, toQ<Q31>(0.5f));
+        CHECK(stateToSample<Q31>(low) == INT32_MIN);
+        /* A full scale step does not overflow the product. */
+        Q31::State high = blendQ<Q31>(low, INT32_MAX, toQ<Q31>(0.75f));
+        CHECK(stateToSample<Q31>(high) == (1 << 30) - 1);
+    }
+
+    SUBCASE("Updates under half a code still move the state.") {
+        Q15::State state15 = blendQ<Q15>(0, 1, toQ<Q15>(0.01f));
+        Q31::State state31 = blendQ<Q31>(0, 1, toQ<Q31>(0.01f));
+        CHECK(state15 > 0);
+        CHECK(state31 > 0);
+    }
+}
@@ -0,0 +1,65 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "../dep/doctest.h"
+#include "Filter/GoertzelFilter.h"
+#include <cmath>
+
+TEST_CASE("Testing the Goertzel filter.") {
+    /* 10 kHz sampling, 200 sample blocks: bins land on multiples of 50 Hz. */
+    const float rate = 10000;
+    GoertzelFilter<2> f({120, 1000}, rate, 200);
+
+    SUBCASE("Read while empty.") {
+        CHECK(f.getResult() == 0);
+        CHECK(f.getMagnitude(1) == 0);
+        CHECK(f.getMagnitude(2) == 0);
+    }
+
+    SUBCASE("Measures the amplitude of each bin.") {
+        GoertzelFilter<2> g({100, 1000}, rate, 200);
+        for (int i = 0; i < 200; i++) {
+            float t = i / rate;
+            g.addSample(12.0 + 0.5 * sin(2 * M_PI * 100 * t) + 0.2 * cos(2 * M_PI * 1000 * t));
+        }
+        CHECK(g.getResult() == doctest::Approx(0.5).epsilon(1e-3));
+        CHECK(g.getMagnitude(1) == doctest::Approx(0.2).epsilon(1e-3));
+    }
+
+    SUBCASE("Rejects other frequencies.") {
+        GoertzelFilter<1> g({1000}, rate, 200);
+        for (int i = 0; i < 200; i++) {
+            g.addSample(12.0 + sin(2 * M_PI * 2000 * i / rate));
+        }
+        CHECK(g.getResult() == doctest::Approx(0.0).epsilon(1e-3));
+    }
+
+    SUBCASE("Holds the magnitude until the next block completes.") {
+        for (int i = 0; i < 199; i++) { f.addSample(sin(2 * M_PI * 1000 * i / rate)); }
+        CHECK(f.getMagnitude(1) == 0);
+        f.addSample(sin(2 * M_PI * 1000 * 199 / rate));
+        float magnitude = f.getMagnitude(1);
+        CHECK(magnitude == doctest::Approx(1.0).epsilon(1e-3));
+        for (int i = 0; i < 100; i++) { f.addSample(0); }
+        CHECK(f.getMagnitude(1) == magnitude);
+    }
+
+    SUBCASE("Batch paths match single samples.") {
+        GoertzelFilter<2> g({120, 1000}, rate, 200);
+        static float samples[1000];
+        for (int i = 0; i < 1000; i++) {
+            samples[i] = 0.3 * sin(2 * M_PI * 1000 * i / rate) + (i % 13) * 0.01;
+        }
+        /* Uneven batches, straddling block boundaries. */
+        g.addSamples(samples, 150);
+        g.addSamples(samples + 150, 333);
+        g.addSamples(samples + 483, 517);
+        for (int i = 0; i < 1000; i++) { f.addSample(samples[i]); }
+        CHECK(g.getResult() == doctest::Approx(f.getResult()));
+        CHECK(g.getMagnitude(1) == doctest::Approx(f.getMagnitude(1)));
+    }
+
+    SUBCASE("Clear.") {
+        for (int i = 0; i < 400; i++) { f.addSample(sin(2 * M_PI * 1000 * i / rate)); }
+        f.clear();
+        CHECK(f.getMagnitude(1) == 0);
+    }
+}
@@ -0,0 +1,165 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "../dep/doctest.h"
+#include "Filter/KalmanFilter.h"
+#include <cmath>
+
+TEST_CASE("Testing the Kalman filter batch API.") {
+    KalmanFilter single = KalmanFilter(5);
+    KalmanFilter batch = KalmanFilter(5);
+    float samples[20];
+    // 20 samples, increasing linearly by 10, and then some noisy 100s every 5 cycles.
+    for (int i = 0; i < 20; i++) {
+        samples[i] = (i%5 == 0) ? 100 : i*10.0;
+    }
+
+    SUBCASE("addSamples matches addSample.") {
+        for (int i = 0; i < 20; i++) {
+            single.addSample(samples[i]);
+        }
+        batch.addSamples(samples, 8);
+        batch.addSamples(samples + 8, 12);
+        CHECK(batch.getResult() == doctest::Approx(single.getResult()));
+    }
+
+    SUBCASE("filterSamples reports the result after every sample.") {
+        float results[20];
+        batch.filterSamples(samples, results, 20);
+        for (int i = 0; i < 20; i++) {
+            single.addSample(samples[i]);
+            CHECK(results[i] == doctest::Approx(single.getResult()));
+        }
+    }
+}
+
+TEST_CASE("Testing the Kalman filter steady state gain.") {
+    /* Computed at compile time. */
+    constexpr float K = KalmanFilter::steadyStateGain(25, 0.15);
+    static_assert(K > 0 && K < 1, "Steady state gain out of range.");
+
+    SUBCASE("The dynamic gain converges to the steady state gain.") {
+        KalmanFilter f(5);
+        CHECK(f.getGain() == doctest::Approx(225.0 / 250.0));
+        for (int i = 0; i < 500; i++) { f.addSample(50.0); }
+        CHECK(f.getGain() == doctest::Approx(K).epsilon(1e-4));
+        CHECK_FALSE(f.isGainFixed());
+    }
+
+    SUBCASE("Steady state mode uses the fixed gain from the first sample.") {
+        KalmanFilter f(5, 10.0, 225, 25, 0.15, KalmanFilter::STEADY_STATE);
+        CHECK(f.isGainFixed());
+        f.addSample(110.0);
+        CHECK(f.getResult() == doctest::Approx(10.0 + K * 100.0));
+    }
+
+    SUBCASE("Auto mode fixes the gain once converged and tracks the dynamic filter.") {
+        KalmanFilter dynamic(5, 10.0, 225, 25, 0.15);
+        KalmanFilter autoGain(5, 10.0, 225, 25, 0.15, KalmanFilter::AUTO);
+        float samples[400];
+        float results[400];
+        for (int i = 0; i < 400; i++) { samples[i] = 50.0 + ((i * 37) % 11) - 5; }
+
+        int fixedAt = -1;
+        for (int i = 0; i < 400; i++) {
+            autoGain.addSample(samples[i]);
+            dynamic.addSample(samples[i]);
+            if (fixedAt < 0 && autoGain.isGainFixed()) { fixedAt = i; }
+            CHECK(std::fabs(autoGain.getResult() - dynamic.getResult()) < 1e-2);
+        }
+        CHECK(fixedAt > 0);
+        CHECK(fixedAt < 400);
+
+        /* Clearing starts converging again; batch calls take the same path. */
+        autoGain.clear();
+        CHECK_FALSE(autoGain.isGainFixed());
+        CHECK(autoGain.getResult() == 10.0);
+        dynamic.clear();
+        autoGain.filterSamples(samples, results, 400);
+        dynamic.addSamples(samples, 400);
+        CHECK(autoGain.isGainFixed());
+        CHECK(results[399] == doctest::Approx(dynamic.getResult()).epsilon(1e-3));
+    }
+}
+
+TEST_CASE("Testing the Kalman filter measurement uncertainty setter.") {
+    SUBCASE("A fixed gain switches to the new steady state.") {
+        KalmanFilter f(5, 10.0, 225, 25, 0.15, KalmanFilter::STEADY_STATE);
+        f.setMeasurementUncertainty(4);
+        CHECK(f.getMeasurementUncertainty() == 4);
+        CHECK(f.getGain() == doctest::Approx(KalmanFilter::steadyStateGain(4, 0.15)));
+
+        /* The uncertainty moves with it, so a dynamic gain resumes there. */
+        f.setGainMode(KalmanFilter::DYNAMIC);
+        CHECK(f.getGain() == doctest::Approx(KalmanFilter::steadyStateGain(4, 0.15)));
+    }
+
+    SUBCASE("A dynamic gain picks up the new uncertainty on the next update.") {
+        KalmanFilter g(5);
+        g.setMeasurementUncertainty(225);
+        CHECK(g.getGain() == doctest::Approx(0.5));
+    }
+
+    SUBCASE("Auto mode locks at the new steady state gain.") {
+        KalmanFilter h(5, 10.0, 225, 25, 0.15, KalmanFilter::AUTO);
+        for (int i = 0; i < 3; i++) { h.addSample(50.0); }
+        CHECK_FALSE(h.isGainFixed());
+        h.setMeasurementUncertainty(1);
+        for (int i = 0; i < 400 && !h.isGainFixed(); i++) { h.addSample(50.0); }
+        CHECK(h.isGainFixed());
+        CHECK(h.getGain() == doctest::Approx(KalmanFilter::steadyStateGain(1, 0.15)));
+    }
+}
+
+TEST_CASE("Testing the Kalman filter adaptive noise estimation.") {
+    /* Gaussian-ish noise with variance 4: sum of 12 uniforms in [-1, 1)
+       has variance 4. */
+    uint32_t seed = 99;
+    float noise[4000];
+    for (int i = 0; i < 4000; i++) {
+        float sum = 0;
+        for (int j = 0; j < 12; j++) {
+            seed = seed * 1103515245 + 12345;
+            sum += ((seed >> 16) % 2000) / 1000.0f - 1.0f;
+        }
+        noise[i] = sum;
+    }
+
+    SUBCASE("Estimates the measurement noise of a steady signal.") {
+        KalmanFilter f(100, 10.0, 225, 25, 0.15, KalmanFilter::ADAPTIVE);
+        for (int i = 0; i < 4000; i++) { f.addSample(50.0 + noise[i]); }
+        CHECK(f.getMeasurementUncertainty() == doctest::Approx(4.0).epsilon(0.35));
+        CHECK(f.getProcessNoiseVariance() < 0.15);
+        CHECK(std::fabs(f.getResult() - 50.0) < 1.0);
+        CHECK_FALSE(f.isGainFixed());
+    }
+
+    SUBCASE("Tracks a step faster than a filter tuned for the steady signal.") {
+        KalmanFilter adaptive(100, 50.0, 1, 4, 0.001, KalmanFilter::ADAPTIVE);
+        KalmanFilter fixed(100, 50.0, 1, 4, 0.001);
+        for (int i = 0; i < 2000; i++) {
+            adaptive.addSample(50.0 + noise[i]);
+            fixed.addSample(50.0 + noise[i]);
+        }
+        int adaptiveSettled = -1;
+        int fixedSettled = -1;
+        for (int i = 2000; i < 4000; i++) {
+            adaptive.addSample(80.0 + noise[i]);
+            fixed.addSample(80.0 + noise[i]);
+            if (adaptiveSettled < 0 && adaptive.getResult() > 75.0) { adaptiveSettled = i; }
+            if (fixedSettled < 0 && fixed.getResult() > 75.0) { fixedSettled = i; }
+        }
+        CHECK(adaptiveSettled > 0);
+        CHECK(adaptiveSettled < fixedSettled);
+    }
+
+    SUBCASE("Batch calls match single calls.") {
+        KalmanFilter single(50, 10.0, 225, 25, 0.15, KalmanFilter::ADAPTIVE);
+        KalmanFilter batch(50, 10.0, 225, 25, 0.15, KalmanFilter::ADAPTIVE);
+        float results[500];
+        batch.filterSamples(noise, results, 500);
+        for (int i = 0; i < 500; i++) {
+            single.addSample(noise[i]);
+            CHECK(results[i] == doctest::Approx(single.getResult()));
+        }
+        CHECK(batch.getMeasurementUncertainty() == doctest::Approx(single.getMeasurementUncertainty()));
+    }
+}
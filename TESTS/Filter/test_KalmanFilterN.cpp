@@ -0,0 +1,88 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "../dep/doctest.h"
+#include "Filter/KalmanFilterN.h"
+#include "Filter/KalmanFilter.h"
+#include <cmath>
+
+TEST_CASE("Testing the matrix helpers.") {
+    Matrix<2, 3> a;
+    Matrix<3, 2> b;
+    for (int r = 0; r < 2; r++) {
+        for (int c = 0; c < 3; c++) {
+            a(r, c) = r * 3 + c + 1;
+            b(c, r) = (r == c) ? 1 : 0;
+        }
+    }
+    Matrix<2, 2> ab = a * b;
+    CHECK(ab(0, 0) == 1);
+    CHECK(ab(0, 1) == 2);
+    CHECK(ab(1, 0) == 4);
+    CHECK(ab(1, 1) == 5);
+    CHECK(a.transpose()(2, 1) == 6);
+    CHECK((Matrix<2, 2>::identity() * 3.0f - ab)(1, 1) == -2);
+}
+
+TEST_CASE("Testing the multi dimensional Kalman filter.") {
+    const float dt = 0.01;
+
+    SUBCASE("Read while empty.") {
+        KalmanFilterN<2> f(dt, 10.0, 225, 25, 0.15);
+        CHECK(f.getResult() == 10.0);
+        CHECK(f.getRate() == 0);
+    }
+
+    SUBCASE("Constant velocity model tracks a ramp without lag.") {
+        KalmanFilterN<2> cv(dt, 0.0, 100, 0.01, 10);
+        KalmanFilter scalar(5, 0.0, 100, 0.01, 0.0001);
+        const float slope = 50.0; /* Units per second. */
+        float z = 0;
+        for (int i = 0; i < 500; i++) {
+            z = slope * dt * i;
+            cv.addSample(z);
+            scalar.addSample(z);
+        }
+        CHECK(std::fabs(cv.getResult() - z) < 0.05);
+        CHECK(cv.getRate() == doctest::Approx(slope).epsilon(0.01));
+        CHECK(cv.getState()[1] == cv.getRate());
+        /* The scalar model lags behind the ramp. */
+        CHECK(std::fabs(scalar.getResult() - z) > std::fabs(cv.getResult() - z));
+    }
+
+    SUBCASE("Constant acceleration model tracks a parabola.") {
+        KalmanFilterN<3> ca(dt, 0.0, 100, 0.01, 100);
+        float z = 0;
+        for (int i = 0; i < 1000; i++) {
+            float t = dt * i;
+            z = 20.0 * t * t;
+            ca.addSample(z);
+        }
+        CHECK(std::fabs(ca.getResult() - z) < 0.05);
+        CHECK(ca.getRate() == doctest::Approx(40.0 * dt * 999).epsilon(0.02));
+        CHECK(ca.getState()[2] == doctest::Approx(40.0).epsilon(0.05));
+    }
+
+    SUBCASE("Measuring rate directly.") {
+        KalmanFilterN<2, 2> f(dt, 0.0, 100, 0.01, 1);
+        for (int i = 0; i < 200; i++) {
+            float z[2] = {5.0f + 2.0f * dt * i, 2.0f};
+            f.addMeasurement(z);
+        }
+        CHECK(f.getRate() == doctest::Approx(2.0).epsilon(0.01));
+        CHECK(f.getCovariance()(0, 0) < 0.01);
+    }
+
+    SUBCASE("Batch calls match single calls.") {
+        KalmanFilterN<2> single(dt, 0.0, 100, 1, 1);
+        KalmanFilterN<2> batch(dt, 0.0, 100, 1, 1);
+        float samples[20];
+        float results[20];
+        for (int i = 0; i < 20; i++) { samples[i] = (i%5 == 0) ? 100 : i*10.0; }
+        batch.filterSamples(samples, results, 20);
+        for (int i = 0; i < 20; i++) {
+            single.addSample(samples[i]);
+            CHECK(results[i] == single.getResult());
+        }
+        batch.clear();
+        CHECK(batch.getResult() == 0);
+    }
+}
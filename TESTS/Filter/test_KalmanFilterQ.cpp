@@ -0,0 +1,50 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "../dep/doctest.h"
+#include "Filter/KalmanFilter.h"
+#include "Filter/KalmanFilterQ.h"
+#include <cmath>
+
+TEST_CASE("Testing the fixed point Kalman filter against the float Kalman filter.") {
+    KalmanFilterQ<Q15> q15(10.0, 225, 25, 0.15);
+    KalmanFilterQ<Q31> q31(10.0, 225, 25, 0.15);
+    KalmanFilter ref(5, 10.0, 225, 25, 0.15);
+
+    CHECK(q15.getResult() == 10);
+
+    uint32_t seed = 3;
+    float maxErr15 = 0;
+    float maxErr31 = 0;
+    for (int i = 0; i < 2000; i++) {
+        seed = seed * 1103515245 + 12345;
+        int16_t code = (int16_t) (1500 + (int) ((seed >> 16) % 40) - 20 + (i / 200) * 50);
+
+        q15.addSample(code);
+        q31.addSample(code);
+        ref.addSample(code);
+
+        maxErr15 = std::fmax(maxErr15, std::fabs(q15.getResult() - ref.getResult()));
+        maxErr31 = std::fmax(maxErr31, std::fabs(q31.getResult() - ref.getResult()));
+    }
+    /* The Q15 gain resolution limits tracking error to a couple of codes. */
+    CHECK(maxErr15 <= 2.0f);
+    CHECK(maxErr31 <= 2.0f);
+
+    q15.clear();
+    CHECK(q15.getResult() == 10);
+    int16_t block[2] = {100, 100};
+    q15.addSamples(block, 2);
+    CHECK(q15.getResult() > 90);
+}
+
+TEST_CASE("Testing the fixed point Kalman filter settles on a constant input.") {
+    /* A small process noise gives a small steady state gain, whose updates
+       would stall short of the input without extra state bits. */
+    KalmanFilterQ<Q15> q15(0, 1, 1, 1e-4);
+    KalmanFilterQ<Q31> q31(0, 1, 1, 1e-4);
+    for (int i = 0; i < 3000; i++) {
+        q15.addSample(1000);
+        q31.addSample(1000);
+    }
+    CHECK(q15.getResult() == 1000);
+    CHECK(q31.getResult() == 1000);
+}
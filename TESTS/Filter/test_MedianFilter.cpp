@@ -2,6 +2,7 @@
 #include "../dep/doctest.h"
 #include "Filter/MedianFilter.h"
 #include <cmath>
+#include <algorithm>
 
 TEST_CASE("Testing the Median filter.") {
     MedianFilter f = MedianFilter(5);
@@ -48,3 +49,87 @@ TEST_CASE("Testing the Median filter.") {
         }
     }
 }
+
+TEST_CASE("Testing the Median filter against a sorted window.") {
+    const uint16_t windows[6] = {1, 2, 4, 7, 10, 64};
+    for (uint16_t w = 0; w < 6; w++) {
+        const uint16_t window = windows[w];
+        MedianFilter f = MedianFilter(window);
+        float history[512];
+        uint32_t seed = 12345;
+
+        for (int i = 0; i < 512; i++) {
+            /* Small LCG with plenty of duplicate values. */
+            seed = seed * 1103515245 + 12345;
+            history[i] = (float) ((seed >> 16) % 50);
+            f.addSample(history[i]);
+
+            int count = (i + 1 < window) ? i + 1 : window;
+            float sorted[64];
+            for (int j = 0; j < count; j++) {
+                sorted[j] = history[i - j];
+            }
+            std::sort(sorted, sorted + count);
+            float expected = (count % 2 == 1)
+                ? sorted[count / 2]
+                : (sorted[count / 2] + sorted[count / 2 - 1]) / 2.0f;
+            CHECK(f.getResult() == expected);
+        }
+
+        SUBCASE("Clear resets the window.") {
+            f.clear();
+            CHECK(f.getResult() == 0);
+            f.addSample(3.0);
+            CHECK(f.getResult() == 3.0);
+        }
+        f.shutdown();
+    }
+}
+
+TEST_CASE("Testing the Median filter batch API.") {
+    MedianFilter single = MedianFilter(5);
+    MedianFilter batch = MedianFilter(5);
+    float samples[20];
+    float results[20];
+    for (int i = 0; i < 20; i++) {
+        samples[i] = (i%5 == 0) ? 100 : i*10.0;
+    }
+
+    batch.filterSamples(samples, results, 20);
+    for (int i = 0; i < 20; i++) {
+        single.addSample(samples[i]);
+        CHECK(results[i] == single.getResult());
+    }
+
+    batch.clear();
+    batch.addSamples(samples, 20);
+    CHECK(batch.getResult() == single.getResult());
+
+    single.shutdown();
+    batch.shutdown();
+}
+
+TEST_CASE("Testing the compile time sized Median filter.") {
+    /* Constant initialized, no heap. */
+    static MedianFilterN<5> f;
+    static MedianFilterN<16> pow2;
+    MedianFilter reference = MedianFilter(16);
+    f.clear();
+    pow2.clear();
+
+    CHECK(f.getResult() == 0);
+
+    double expected_res[20] = {
+        100, 55, 20, 25, 30, 30, 40, 60, 70, 80,
+        80, 90, 100, 110, 120, 120, 130, 140, 160, 170
+    };
+    for (int i = 0; i < 20; i++) {
+        float sample = (i%5 == 0) ? 100 : i*10.0;
+        f.addSample(sample);
+        pow2.addSample(sample);
+        reference.addSample(sample);
+        CHECK(f.getResult() == expected_res[i]);
+        CHECK(pow2.getResult() == reference.getResult());
+    }
+    reference.shutdown();
+}
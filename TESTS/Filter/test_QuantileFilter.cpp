@@ -0,0 +1,89 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "../dep/doctest.h"
+#include "Filter/QuantileFilter.h"
+#include <algorithm>
+#include <cstdlib>
+
+TEST_CASE("Testing the streaming quantile filter.") {
+    QuantileFilter f = QuantileFilter(0.5);
+
+    SUBCASE("Read while empty.") {
+        CHECK(f.getResult() == 0);
+        CHECK(f.getMin() == 0);
+        CHECK(f.getMax() == 0);
+    }
+
+    SUBCASE("Exact for the first samples.") {
+        f.addSample(3.0);
+        CHECK(f.getResult() == doctest::Approx(3.0));
+        f.addSample(1.0);
+        f.addSample(2.0);
+        CHECK(f.getResult() == doctest::Approx(2.0));
+        CHECK(f.getMin() == doctest::Approx(1.0));
+        CHECK(f.getMax() == doctest::Approx(3.0));
+    }
+
+    SUBCASE("A constant stream.") {
+        for (int i = 0; i < 100; i++) { f.addSample(12.0); }
+        CHECK(f.getResult() == doctest::Approx(12.0));
+    }
+
+    SUBCASE("Matches sorted quantiles of a long stream.") {
+        const int numSamples = 20000;
+        static float samples[numSamples];
+        const float quantiles[4] = {0.5, 0.9, 0.95, 0.99};
+        srand(11);
+        for (int i = 0; i < numSamples; i++) {
+            /* Skewed, like irradiance under passing clouds. */
+            float u = (rand() % 10000) / 10000.0;
+            samples[i] = 100 + 900 * u * u;
+        }
+        for (int q = 0; q < 4; q++) {
+            QuantileFilter g = QuantileFilter(quantiles[q]);
+            g.addSamples(samples, numSamples);
+            static float sorted[numSamples];
+            std::copy(samples, samples + numSamples, sorted);
+            std::sort(sorted, sorted + numSamples);
+            float exact = sorted[(int) (quantiles[q] * (numSamples - 1))];
+            CHECK(g.getResult() == doctest::Approx(exact).epsilon(2e-2));
+            CHECK(g.getMin() == doctest::Approx(sorted[0]));
+            CHECK(g.getMax() == doctest::Approx(sorted[numSamples - 1]));
+        }
+    }
+
+    SUBCASE("Batch paths match single samples.") {
+        QuantileFilter g = QuantileFilter(0.9);
+        QuantileFilter h = QuantileFilter(0.9);
+        float samples[200];
+        float results[200];
+        for (int i = 0; i < 200; i++) { samples[i] = (i * 37) % 101; }
+        g.filterSamples(samples, results, 200);
+        for (int i = 0; i < 200; i++) {
+            h.addSample(samples[i]);
+            CHECK(results[i] == doctest::Approx(h.getResult()));
+        }
+    }
+
+    SUBCASE("Clear.") {
+        for (int i = 0; i < 50; i++) { f.addSample(i); }
+        f.clear();
+        CHECK(f.getResult() == 0);
+        f.addSample(7.0);
+        CHECK(f.getResult() == doctest::Approx(7.0));
+    }
+
+    SUBCASE("Snapshot round trip.") {
+        for (int i = 0; i < 50; i++) { f.addSample((i * 13) % 17); }
+        uint8_t buffer[64];
+        size_t len = f.serialize(buffer, sizeof(buffer));
+        CHECK(len > 0);
+        QuantileFilter g = QuantileFilter(0.5);
+        CHECK(g.deserialize(buffer, len));
+        for (int i = 0; i < 50; i++) {
+            f.addSample((i * 7) % 23);
+            g.addSample((i * 7) % 23);
+        }
+        CHECK(g.getResult() == doctest::Approx(f.getResult()));
+        CHECK_FALSE(g.deserialize(buffer, len - 1));
+    }
+}
@@ -1,9 +1,10 @@
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
 #include "../dep/doctest.h"
-#include "Filter/SMAFilter.h"
+#include "Filter/SmaFilter.h"
+#include <cmath>
 
 TEST_CASE("Testing the SMA filter.") {
-    SMAFilter f = SMAFilter(5);
+    SmaFilter f = SmaFilter(5);
 
     SUBCASE("Read while empty.") {
         CHECK(f.getResult() == 0);
@@ -47,3 +48,67 @@ TEST_CASE("Testing the SMA filter.") {
         }
     }
 }
+
+TEST_CASE("Testing the SMA filter batch API.") {
+    SmaFilter single = SmaFilter(7);
+    SmaFilter batch = SmaFilter(7);
+    float samples[50];
+    for (int i = 0; i < 50; i++) {
+        samples[i] = (i%5 == 0) ? 100 : i*10.0;
+        single.addSample(samples[i]);
+    }
+
+    SUBCASE("addSamples matches addSample.") {
+        /* Uneven block sizes so blocks straddle the buffer wrap point. */
+        batch.addSamples(samples, 3);
+        batch.addSamples(samples + 3, 20);
+        batch.addSamples(samples + 23, 27);
+        CHECK(batch.getResult() == doctest::Approx(single.getResult()));
+    }
+
+    SUBCASE("filterSamples reports the result after every sample.") {
+        SmaFilter reference = SmaFilter(7);
+        float results[50];
+        batch.filterSamples(samples, results, 50);
+        for (int i = 0; i < 50; i++) {
+            reference.addSample(samples[i]);
+            CHECK(results[i] == doctest::Approx(reference.getResult()));
+        }
+        reference.shutdown();
+    }
+
+    single.shutdown();
+    batch.shutdown();
+}
+
+TEST_CASE("Testing the compile time sized SMA filter.") {
+    /* Constant initialized, no heap. */
+    static SmaFilterN<5> f;
+    static SmaFilterN<8> pow2;
+    SmaFilter reference = SmaFilter(8);
+    f.clear();
+    pow2.clear();
+
+    CHECK(f.getResult() == 0);
+
+    double expected_res[20] = {
+        100, 55, 43.33, 40, 40, 40, 50, 60, 70, 80,
+        80, 90, 100, 110, 120, 120, 130, 140, 150, 160
+    };
+    for (int i = 0; i < 20; i++) {
+        float sample = (i%5 == 0) ? 100 : i*10.0;
+        f.addSample(sample);
+        pow2.addSample(sample);
+        reference.addSample(sample);
+        CHECK(std::trunc(f.getResult() * 100.0) / 100.0 == expected_res[i]);
+        CHECK(pow2.getResult() == doctest::Approx(reference.getResult()));
+    }
+
+    float samples[30];
+    for (int i = 0; i < 30; i++) { samples[i] = i * 3.0; }
+    pow2.addSamples(samples, 13);
+    pow2.addSamples(samples + 13, 17);
+    reference.addSamples(samples, 30);
+    CHECK(pow2.getResult() == doctest::Approx(reference.getResult()));
+    reference.shutdown();
+}
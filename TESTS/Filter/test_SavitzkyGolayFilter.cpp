@@ -0,0 +1,102 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "../dep/doctest.h"
+#include "Filter/SavitzkyGolayFilter.h"
+#include <cstdlib>
+
+TEST_CASE("Testing the Savitzky-Golay design.") {
+    SUBCASE("Centered quadratic taps match the published table.") {
+        constexpr auto fit = SavitzkyGolayDesign::fit<5, 2>(2);
+        const float smooth[5] = {-3, 12, 17, 12, -3};
+        const float slope[5] = {2, 1, 0, -1, -2};
+        for (int k = 0; k < 5; k++) {
+            CHECK(fit.smooth[k] == doctest::Approx(smooth[k] / 35));
+            CHECK(fit.slope[k] == doctest::Approx(slope[k] / 10));
+        }
+    }
+
+    SUBCASE("Smoothing taps sum to one and slope taps to zero.") {
+        constexpr auto fit = SavitzkyGolayDesign::fit<15, 3>(0);
+        float smooth = 0;
+        float slope = 0;
+        for (int k = 0; k < 15; k++) {
+            smooth += fit.smooth[k];
+            slope += fit.slope[k];
+        }
+        CHECK(smooth == doctest::Approx(1.0));
+        CHECK(slope == doctest::Approx(0.0).epsilon(1e-5));
+    }
+}
+
+TEST_CASE("Testing the Savitzky-Golay filter.") {
+    const float dt = 0.01;
+    SavitzkyGolayFilter<11> f(SavitzkyGolayDesign::fit<11, 2>(5), dt);
+
+    SUBCASE("Read while empty.") {
+        CHECK(f.getResult() == 0);
+        CHECK(f.getDerivative() == 0);
+    }
+
+    SUBCASE("A quadratic passes through exactly.") {
+        /* y = 2 t^2 - t + 3, read back 5 samples late. */
+        float t = 0;
+        for (int i = 0; i < 30; i++) {
+            t = i * dt;
+            f.addSample(2 * t * t - t + 3);
+        }
+        float te = t - 5 * dt;
+        CHECK(f.getResult() == doctest::Approx(2 * te * te - te + 3));
+        CHECK(f.getDerivative() == doctest::Approx(4 * te - 1).epsilon(1e-3));
+    }
+
+    SUBCASE("A newest sample fit has no lag.") {
+        SavitzkyGolayFilter<11> g(SavitzkyGolayDesign::fit<11, 1>(0), dt);
+        for (int i = 0; i < 30; i++) { g.addSample(5.0 * i * dt); }
+        CHECK(g.getResult() == doctest::Approx(5.0 * 29 * dt));
+        CHECK(g.getDerivative() == doctest::Approx(5.0).epsilon(1e-3));
+    }
+
+    SUBCASE("The derivative is quieter than a difference.") {
+        srand(3);
+        double fitError = 0;
+        double diffError = 0;
+        float prev = 0;
+        for (int i = 0; i < 500; i++) {
+            float sample = 2.0 * i * dt + ((rand() % 1000) / 1000.0 - 0.5) * 0.01;
+            f.addSample(sample);
+            if (i >= 11) {
+                fitError += (f.getDerivative() - 2.0) * (f.getDerivative() - 2.0);
+                float diff = (sample - prev) / dt;
+                diffError += (diff - 2.0) * (diff - 2.0);
+            }
+            prev = sample;
+        }
+        CHECK(fitError * 10 < diffError);
+    }
+
+    SUBCASE("Batch paths match single samples.") {
+        SavitzkyGolayFilter<11> g(SavitzkyGolayDesign::fit<11, 2>(5), dt);
+        float samples[64];
+        float results[64];
+        for (int i = 0; i < 64; i++) { samples[i] = (i % 9) * 0.5; }
+        g.filterSamples(samples, results, 64);
+        for (int i = 0; i < 64; i++) {
+            f.addSample(samples[i]);
+            CHECK(results[i] == doctest::Approx(f.getResult()));
+        }
+        CHECK(g.getDerivative() == doctest::Approx(f.getDerivative()));
+    }
+
+    SUBCASE("Time step.") {
+        for (int i = 0; i < 20; i++) { f.addSample(i); }
+        CHECK(f.getDerivative() == doctest::Approx(1 / dt));
+        f.setTimeStep(1);
+        CHECK(f.getDerivative() == doctest::Approx(1.0));
+    }
+
+    SUBCASE("Clear.") {
+        for (int i = 0; i < 20; i++) { f.addSample(i); }
+        f.clear();
+        CHECK(f.getResult() == 0);
+        CHECK(f.getDerivative() == 0);
+    }
+}
@@ -0,0 +1,68 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "../dep/doctest.h"
+#include "Filter/SlidingExtremaFilter.h"
+#include <algorithm>
+#include <cstdlib>
+
+TEST_CASE("Testing the sliding extrema filter.") {
+    SlidingExtremaFilter f = SlidingExtremaFilter(4);
+
+    SUBCASE("Read while empty.") {
+        CHECK(f.getResult() == 0);
+        CHECK(f.getMin() == 0);
+        CHECK(f.getRange() == 0);
+    }
+
+    SUBCASE("Extrema slide out of the window.") {
+        float samples[6] = {5, 1, 3, 4, 2, 6};
+        f.addSamples(samples, 4);
+        CHECK(f.getMin() == 1);
+        CHECK(f.getMax() == 5);
+        f.addSample(samples[4]);
+        CHECK(f.getMin() == 1);
+        CHECK(f.getMax() == 4);
+        f.addSample(samples[5]);
+        CHECK(f.getMin() == 2);
+        CHECK(f.getMax() == 6);
+    }
+
+    SUBCASE("Result modes.") {
+        float samples[3] = {2, 7, 3};
+        f.addSamples(samples, 3);
+        CHECK(f.getResult() == 7);
+        f.setMode(SlidingExtremaFilter::MIN);
+        CHECK(f.getResult() == 2);
+        f.setMode(SlidingExtremaFilter::RANGE);
+        CHECK(f.getResult() == 5);
+    }
+
+    SUBCASE("Clear.") {
+        f.addSample(3);
+        f.clear();
+        CHECK(f.getMax() == 0);
+        f.addSample(-1);
+        CHECK(f.getMax() == -1);
+    }
+
+    SUBCASE("Matches a brute force window.") {
+        const int window = 7;
+        SlidingExtremaFilter g = SlidingExtremaFilter(window);
+        float samples[500];
+        float results[500];
+        srand(12);
+        for (int i = 0; i < 500; i++) {
+            samples[i] = (float) (rand() % 20);
+        }
+        g.setMode(SlidingExtremaFilter::RANGE);
+        g.filterSamples(samples, results, 500);
+        for (int i = 0; i < 500; i++) {
+            int start = std::max(0, i - window + 1);
+            float lo = *std::min_element(samples + start, samples + i + 1);
+            float hi = *std::max_element(samples + start, samples + i + 1);
+            CHECK(results[i] == hi - lo);
+        }
+        g.shutdown();
+    }
+
+    f.shutdown();
+}
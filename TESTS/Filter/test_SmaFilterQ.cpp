@@ -0,0 +1,37 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "../dep/doctest.h"
+#include "Filter/SmaFilter.h"
+#include "Filter/SmaFilterQ.h"
+#include <cmath>
+
+TEST_CASE("Testing the fixed point SMA filter against the float SMA filter.") {
+    SmaFilterQ<Q15, 10> q15;
+    SmaFilterQ<Q31, 16> q31;
+    SmaFilterN<10> ref15;
+    SmaFilterN<16> ref31;
+
+    CHECK(q15.getResult() == 0);
+
+    /* 12 bit ADC codes: a ramp with noise and spikes. */
+    uint32_t seed = 1;
+    for (int i = 0; i < 500; i++) {
+        seed = seed * 1103515245 + 12345;
+        int16_t code = (int16_t) ((i * 7) % 4096 + (seed >> 16) % 64);
+        if (i % 37 == 0) { code = 4095; }
+
+        q15.addSample(code);
+        q31.addSample((int32_t) code << 16);
+        ref15.addSample(code);
+        ref31.addSample(code);
+
+        /* Rounded to the nearest code. */
+        CHECK(std::fabs(q15.getResult() - ref15.getResult()) <= 0.5f + 1e-3f);
+        CHECK(std::fabs(q31.getResult() / 65536.0f - ref31.getResult()) <= 1e-3f);
+    }
+
+    q15.clear();
+    CHECK(q15.getResult() == 0);
+    int16_t block[4] = {-100, -200, -300, -401};
+    q15.addSamples(block, 4);
+    CHECK(q15.getResult() == -250);
+}
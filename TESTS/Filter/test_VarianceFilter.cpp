@@ -0,0 +1,123 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "../dep/doctest.h"
+#include "Filter/VarianceFilter.h"
+#include <cmath>
+#include <cstdlib>
+
+TEST_CASE("Testing the sliding variance filter.") {
+    VarianceFilter f = VarianceFilter(4);
+
+    SUBCASE("Read while empty.") {
+        CHECK(f.getResult() == 0);
+        CHECK(f.getMean() == 0);
+        CHECK(f.getStdDev() == 0);
+    }
+
+    SUBCASE("Statistics of a full window.") {
+        float samples[4] = {2, 4, 4, 6};
+        f.addSamples(samples, 4);
+        CHECK(f.getMean() == doctest::Approx(4.0));
+        CHECK(f.getVariance() == doctest::Approx(2.0));
+        f.setMode(VarianceFilter::STDDEV);
+        CHECK(f.getResult() == doctest::Approx(sqrt(2.0)));
+        f.setMode(VarianceFilter::MEAN);
+        CHECK(f.getResult() == doctest::Approx(4.0));
+    }
+
+    SUBCASE("A constant window has no variance.") {
+        for (int i = 0; i < 10; i++) { f.addSample(3.3); }
+        CHECK(f.getVariance() == doctest::Approx(0.0));
+    }
+
+    SUBCASE("Matches a brute force window.") {
+        const int window = 16;
+        VarianceFilter g = VarianceFilter(window);
+        float samples[1000];
+        float results[1000];
+        srand(7);
+        for (int i = 0; i < 1000; i++) {
+            samples[i] = 12.0 + (rand() % 1000) / 1000.0;
+        }
+        g.filterSamples(samples, results, 1000);
+        for (int i = window; i < 1000; i += 37) {
+            double mean = 0;
+            for (int j = i - window + 1; j <= i; j++) { mean += samples[j]; }
+            mean /= window;
+            double variance = 0;
+            for (int j = i - window + 1; j <= i; j++) {
+                variance += (samples[j] - mean) * (samples[j] - mean);
+            }
+            variance /= window;
+            CHECK(results[i] == doctest::Approx(variance).epsilon(1e-2));
+        }
+        g.shutdown();
+    }
+
+    SUBCASE("Does not drift over a long run.") {
+        /* An 85 V channel with 10 mV of gaussian noise and a 5 V step every
+           100k samples, for about an hour at 1 kHz. */
+        const int window = 64;
+        VarianceFilter g = VarianceFilter(window);
+        float history[window];
+        uint32_t seed = 1;
+        for (int i = 0; i < 4000000; i++) {
+            seed = seed * 1103515245 + 12345;
+            const double u1 = ((seed >> 8) + 1) / 16777217.0;
+            seed = seed * 1103515245 + 12345;
+            const double u2 = (seed >> 8) / 16777216.0;
+            const double noise = sqrt(-2 * log(u1)) * cos(2 * M_PI * u2);
+            const float sample = ((i / 100000) % 2 ? 90.0 : 85.0) + 0.01 * noise;
+            history[i % window] = sample;
+            g.addSample(sample);
+
+            if (i % 250000 == 249999) {
+                /* Two pass reference over the window. */
+                double mean = 0;
+                for (int j = 0; j < window; j++) { mean += history[j]; }
+                mean /= window;
+                double variance = 0;
+                for (int j = 0; j < window; j++) {
+                    variance += (history[j] - mean) * (history[j] - mean);
+                }
+                variance /= window;
+                CHECK(g.getMean() == doctest::Approx(mean).epsilon(1e-6));
+                CHECK(g.getVariance() == doctest::Approx(variance).epsilon(1e-2));
+            }
+        }
+        g.shutdown();
+    }
+
+    f.shutdown();
+}
+
+TEST_CASE("Testing the exponentially weighted variance filter.") {
+    EmaVarianceFilter f = EmaVarianceFilter(0.1);
+
+    SUBCASE("The first sample seeds the mean.") {
+        f.addSample(5.0);
+        CHECK(f.getMean() == 5.0);
+        CHECK(f.getVariance() == 0);
+    }
+
+    SUBCASE("Converges to the variance of a square wave.") {
+        float samples[2000];
+        for (int i = 0; i < 2000; i++) { samples[i] = (i % 2) ? 1.0 : -1.0; }
+        f.addSamples(samples, 2000);
+        CHECK(fabs(f.getMean()) < 0.1);
+        CHECK(f.getVariance() == doctest::Approx(1.0).epsilon(0.1));
+        f.setMode(EmaVarianceFilter::STDDEV);
+        CHECK(f.getResult() == doctest::Approx(1.0).epsilon(0.1));
+    }
+
+    SUBCASE("filterSamples matches addSample.") {
+        EmaVarianceFilter g = EmaVarianceFilter(0.1);
+        float samples[50];
+        float results[50];
+        for (int i = 0; i < 50; i++) { samples[i] = (i * 7) % 5; }
+        f.filterSamples(samples, results, 50);
+        for (int i = 0; i < 50; i++) {
+            g.addSample(samples[i]);
+            CHECK(results[i] == doctest::Approx(g.getResult()));
+        }
+    }
+}
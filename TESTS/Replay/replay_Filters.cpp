@@ -0,0 +1,351 @@
+/**
+ * Project: Mbed-Shared-Components
+ * File: replay_Filters.cpp
+ * Author: Matthew Yu
+ * Created on: 10/17/26
+ * Last Modified: 10/17/26
+ * File Description: This program replays a logged sensor trace through a grid
+ * of SmaFilter, EmaFilter, MedianFilter and KalmanFilter configurations on the
+ * host, so filter settings can be tuned against real car data offline instead
+ * of on the bench. Configurations are spread across all cores.
+ *
+ * Usage:
+ *     ./replay_Filters [-b] [-c column] [-l maxLag] [-j threads] trace
+ *
+ * - Traces are CSV by default, one sample per line. -c selects the 0 indexed
+ *   column to read; lines where it is not a number (i.e. headers) are skipped.
+ * - -b, or a .bin extension, reads the trace as raw native endian floats, as
+ *   dumped from a sample buffer.
+ * - -l bounds the lag measurement, and the number of samples the filters get
+ *   to settle, in samples. Defaults to 256.
+ * - -j sets the number of worker threads. Defaults to the number of cores.
+ *
+ * Output is CSV:
+ *     filter,params,lag_samples,noise_reduction_db,ns_per_sample
+ *
+ * - lag_samples is the number of samples the output takes to get halfway
+ *   through a step from the trace minimum to its maximum, interpolated
+ *   between samples. Raise -l if it reads as maxLag.
+ * - noise_reduction_db compares the RMS sample to sample change of the input
+ *   against that of the output. White noise dominates the sample to sample
+ *   change of a slow signal, so this tracks how much noise the filter removes.
+ * - ns_per_sample is the cost of filterSamples over the whole trace. Workers
+ *   share the machine, so compare it between rows rather than to hardware.
+ * - The first maxLag samples of the trace are left out of the noise
+ *   reduction, so that filters have settled from their initial state.
+ */
+#include "Filter/Filter.h"
+#include "Filter/SmaFilter.h"
+#include "Filter/EmaFilter.h"
+#include "Filter/MedianFilter.h"
+#include "Filter/KalmanFilter.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <thread>
+#include <vector>
+
+#define DEFAULT_MAX_LAG 256
+#define LINE_SIZE 1024
+
+/** A single filter configuration of the grid. */
+struct Config {
+    enum Kind {SMA, EMA, MEDIAN, KALMAN, KALMAN_ADAPTIVE};
+
+    Kind kind;
+    /** Window size, for the windowed filters and the ADAPTIVE Kalman mode. */
+    uint16_t window;
+    /** EMA alpha, or the Kalman measurement uncertainty R. */
+    float a;
+    /** Kalman process noise variance Q. */
+    float b;
+};
+
+/** Metrics of a configuration over the trace. */
+struct Result {
+    double lag;
+    double noiseReductionDb;
+    double nsPerSample;
+};
+
+/** Returns the grid of configurations to replay. */
+static std::vector<Config> makeGrid(void) {
+    static const uint16_t windows[] = {4, 8, 16, 32, 64, 128};
+    static const uint16_t medianWindows[] = {3, 5, 9, 15, 31, 63};
+    static const float alphas[] = {0.02f, 0.05f, 0.1f, 0.2f, 0.4f};
+    static const float rs[] = {1.0f, 4.0f, 25.0f, 100.0f};
+    static const float qs[] = {0.001f, 0.01f, 0.05f, 0.15f};
+    static const uint16_t adaptiveWindows[] = {16, 64, 256};
+
+    std::vector<Config> grid;
+    for (uint16_t window : windows) {
+        grid.push_back({Config::SMA, window, 0, 0});
+    }
+    for (float alpha : alphas) {
+        grid.push_back({Config::EMA, 10, alpha, 0});
+    }
+    for (uint16_t window : medianWindows) {
+        grid.push_back({Config::MEDIAN, window, 0, 0});
+    }
+    for (float r : rs) {
+        for (float q : qs) {
+            grid.push_back({Config::KALMAN, 10, r, q});
+        }
+    }
+    for (uint16_t window : adaptiveWindows) {
+        grid.push_back({Config::KALMAN_ADAPTIVE, window, 25.0f, 0.15f});
+    }
+    return grid;
+}
+
+/** Prints the filter name and parameters of a configuration as CSV. */
+static void printConfig(const Config & config) {
+    switch (config.kind) {
+        case Config::SMA:
+            printf("SmaFilter,N=%u", config.window);
+            break;
+        case Config::EMA:
+            printf("EmaFilter,alpha=%g", config.a);
+            break;
+        case Config::MEDIAN:
+            printf("MedianFilter,N=%u", config.window);
+            break;
+        case Config::KALMAN:
+            printf("KalmanFilter,R=%g Q=%g", config.a, config.b);
+            break;
+        case Config::KALMAN_ADAPTIVE:
+            printf("KalmanFilter (adaptive),N=%u", config.window);
+            break;
+    }
+}
+
+/**
+ * Filters the whole trace and returns the time it took, in nanoseconds.
+ * Shuts the filter down afterwards.
+ */
+static double timeFilter(
+    Filter & filter,
+    const float * samples,
+    float * results,
+    const size_t numSamples
+) {
+    auto start = std::chrono::steady_clock::now();
+    filter.filterSamples(samples, results, numSamples);
+    auto end = std::chrono::steady_clock::now();
+    filter.shutdown();
+    return std::chrono::duration<double, std::nano>(end - start).count();
+}
+
+/**
+ * Runs a configuration over the trace. Filters are constructed here, on the
+ * worker's stack, since Filter has no virtual destructor to delete them
+ * through.
+ */
+static double replay(
+    const Config & config,
+    const float * samples,
+    float * results,
+    const size_t numSamples
+) {
+    switch (config.kind) {
+        case Config::SMA: {
+            SmaFilter filter(config.window);
+            return timeFilter(filter, samples, results, numSamples);
+        }
+        case Config::EMA: {
+            EmaFilter filter(config.window, config.a);
+            return timeFilter(filter, samples, results, numSamples);
+        }
+        case Config::MEDIAN: {
+            MedianFilter filter(config.window);
+            return timeFilter(filter, samples, results, numSamples);
+        }
+        case Config::KALMAN: {
+            KalmanFilter filter(config.window, samples[0], 225.0f, config.a, config.b);
+            return timeFilter(filter, samples, results, numSamples);
+        }
+        case Config::KALMAN_ADAPTIVE: {
+            KalmanFilter filter(config.window, samples[0], 225.0f, config.a, config.b,
+                KalmanFilter::ADAPTIVE);
+            return timeFilter(filter, samples, results, numSamples);
+        }
+    }
+    return 0;
+}
+
+/**
+ * Returns the lag of a configuration: the number of samples its output takes
+ * to cross halfway through a step, interpolated between samples, or maxLag if
+ * it does not within maxLag samples. The filter settles on the low level for
+ * maxLag samples first.
+ * 
+ * Lag is measured on a step rather than on the trace itself. The cross
+ * correlation of a slow trace and its filtered copy has a peak so flat that
+ * noise moves it by more than the lag being measured.
+ */
+static double measureLag(
+    const Config & config,
+    const float low,
+    const float high,
+    const size_t maxLag
+) {
+    std::vector<float> step(2 * maxLag + 1, high);
+    std::fill(step.begin(), step.begin() + maxLag, low);
+    std::vector<float> output(step.size());
+    replay(config, step.data(), output.data(), step.size());
+
+    /* The step falls halfway between samples maxLag - 1 and maxLag, so that
+     * a passthrough has no lag and a delay of D samples has a lag of D. */
+    const float mid = (low + high) / 2;
+    float prev = output[maxLag - 1];
+    if (prev >= mid) { return 0; }
+    for (size_t i = 0; i <= maxLag; ++i) {
+        const float cur = output[maxLag + i];
+        if (cur >= mid) {
+            return i - 0.5 + (mid - prev) / (cur - prev);
+        }
+        prev = cur;
+    }
+    return maxLag;
+}
+
+/** Returns the RMS sample to sample change of a trace from index first on. */
+static double rmsChange(const float * values, const size_t first, const size_t numSamples) {
+    double sum = 0;
+    for (size_t i = first + 1; i < numSamples; ++i) {
+        const double diff = values[i] - values[i - 1];
+        sum += diff * diff;
+    }
+    return sqrt(sum / (numSamples - first - 1));
+}
+
+/**
+ * Reads a column of a CSV trace. Lines where the column is missing or not a
+ * number are skipped.
+ */
+static bool loadCsv(const char * path, const int column, std::vector<float> & trace) {
+    FILE * file = fopen(path, "r");
+    if (file == nullptr) { return false; }
+
+    char line[LINE_SIZE];
+    while (fgets(line, sizeof(line), file) != nullptr) {
+        const char * field = line;
+        for (int i = 0; i < column && field != nullptr; ++i) {
+            field = strchr(field, ',');
+            if (field != nullptr) { ++field; }
+        }
+        if (field == nullptr) { continue; }
+
+        char * end;
+        const float sample = strtof(field, &end);
+        if (end != field) { trace.push_back(sample); }
+    }
+    fclose(file);
+    return true;
+}
+
+/** Reads a trace of raw native endian floats. */
+static bool loadBinary(const char * path, std::vector<float> & trace) {
+    FILE * file = fopen(path, "rb");
+    if (file == nullptr) { return false; }
+
+    float block[LINE_SIZE];
+    size_t numRead;
+    while ((numRead = fread(block, sizeof(float), LINE_SIZE, file)) > 0) {
+        trace.insert(trace.end(), block, block + numRead);
+    }
+    fclose(file);
+    return true;
+}
+
+static void usage(const char * name) {
+    fprintf(stderr,
+        "Usage: %s [-b] [-c column] [-l maxLag] [-j threads] trace\n", name);
+}
+
+int main(int argc, char ** argv) {
+    bool binary = false;
+    int column = 0;
+    size_t maxLag = DEFAULT_MAX_LAG;
+    unsigned numThreads = std::thread::hardware_concurrency();
+    const char * path = nullptr;
+
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "-b") == 0) {
+            binary = true;
+        } else if (strcmp(argv[i], "-c") == 0 && i + 1 < argc) {
+            column = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-l") == 0 && i + 1 < argc) {
+            maxLag = strtoul(argv[++i], nullptr, 10);
+        } else if (strcmp(argv[i], "-j") == 0 && i + 1 < argc) {
+            numThreads = strtoul(argv[++i], nullptr, 10);
+        } else if (path == nullptr && argv[i][0] != '-') {
+            path = argv[i];
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    if (path == nullptr || column < 0) {
+        usage(argv[0]);
+        return 1;
+    }
+    const size_t pathLen = strlen(path);
+    if (pathLen > 4 && strcmp(path + pathLen - 4, ".bin") == 0) { binary = true; }
+    if (numThreads == 0) { numThreads = 1; }
+
+    std::vector<float> trace;
+    if (!(binary ? loadBinary(path, trace) : loadCsv(path, column, trace))) {
+        fprintf(stderr, "Could not open %s.\n", path);
+        return 1;
+    }
+    if (maxLag == 0 || trace.size() < maxLag + 2) {
+        fprintf(stderr, "%s has %zu samples; at least %zu are needed to settle "
+            "for %zu.\n", path, trace.size(), maxLag + 2, maxLag);
+        return 1;
+    }
+
+    const std::vector<Config> grid = makeGrid();
+    std::vector<Result> results(grid.size());
+    const size_t numSamples = trace.size();
+    const double inputChange = rmsChange(trace.data(), maxLag, numSamples);
+    const float low = *std::min_element(trace.begin(), trace.end());
+    float high = *std::max_element(trace.begin(), trace.end());
+    if (high <= low) { high = low + 1; }
+
+    /* Workers pull the next configuration off a shared counter, so uneven
+     * costs (i.e. wide median windows) balance out across cores. */
+    std::atomic<size_t> next(0);
+    auto worker = [&]() {
+        std::vector<float> output(numSamples);
+        size_t index;
+        while ((index = next.fetch_add(1)) < grid.size()) {
+            const double ns = replay(grid[index], trace.data(), output.data(), numSamples);
+            Result & result = results[index];
+            result.lag = measureLag(grid[index], low, high, maxLag);
+            result.noiseReductionDb = 20 * log10(
+                inputChange / rmsChange(output.data(), maxLag, numSamples));
+            result.nsPerSample = ns / numSamples;
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (unsigned i = 0; i < numThreads; ++i) {
+        threads.emplace_back(worker);
+    }
+    for (std::thread & thread : threads) {
+        thread.join();
+    }
+
+    printf("filter,params,lag_samples,noise_reduction_db,ns_per_sample\n");
+    for (size_t i = 0; i < grid.size(); ++i) {
+        printConfig(grid[i]);
+        printf(",%.2f,%.2f,%.2f\n", results[i].lag, results[i].noiseReductionDb,
+            results[i].nsPerSample);
+    }
+    return 0;
+}
@@ -0,0 +1,144 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "../dep/doctest.h"
+#include "RingBuffer/RingBuffer.h"
+
+TEST_CASE("Testing the ring buffer capacity helper.") {
+    CHECK(ringCapacity(1) == 1);
+    CHECK(ringCapacity(2) == 2);
+    CHECK(ringCapacity(7) == 8);
+    CHECK(ringCapacity(64) == 64);
+    CHECK(ringCapacity(65) == 128);
+    static_assert(ringCapacity(10) == 16, "ringCapacity should be constexpr.");
+}
+
+TEST_CASE("Testing the fixed size ring buffer.") {
+    RingBuffer<int, 8> ring;
+
+    SUBCASE("Starts empty.") {
+        CHECK(ring.valid());
+        CHECK(ring.empty());
+        CHECK(ring.size() == 0);
+        CHECK(ring.capacity() == 8);
+        int item = 0;
+        CHECK_FALSE(ring.pop(item));
+    }
+
+    SUBCASE("First in, first out.") {
+        for (int i = 0; i < 5; i++) { CHECK(ring.push(i)); }
+        CHECK(ring.size() == 5);
+        CHECK(ring.front() == 0);
+        CHECK(ring.back() == 4);
+        CHECK(ring[2] == 2);
+        int item = -1;
+        CHECK(ring.pop(item));
+        CHECK(item == 0);
+        CHECK(ring.front() == 1);
+    }
+
+    SUBCASE("Removes from the back.") {
+        for (int i = 0; i < 8; i++) { ring.push(i); }
+        ring.popBack();
+        ring.popBack();
+        CHECK(ring.size() == 6);
+        CHECK(ring.back() == 5);
+        CHECK(ring.push(10));
+        CHECK(ring.back() == 10);
+        CHECK(ring.front() == 0);
+    }
+
+    SUBCASE("Uses every slot and rejects pushes when full.") {
+        for (int i = 0; i < 8; i++) { CHECK(ring.push(i)); }
+        CHECK(ring.full());
+        CHECK_FALSE(ring.push(8));
+        CHECK(ring.back() == 7);
+    }
+
+    SUBCASE("Wraps around many times.") {
+        int next = 0;
+        int expected = 0;
+        for (int round = 0; round < 100; round++) {
+            for (int i = 0; i < 5; i++) { ring.push(next++); }
+            for (int i = 0; i < 5; i++) {
+                int item = -1;
+                CHECK(ring.pop(item));
+                CHECK(item == expected++);
+            }
+        }
+        CHECK(ring.empty());
+    }
+
+    SUBCASE("Spans split at the wrap point.") {
+        for (int i = 0; i < 6; i++) { ring.push(i); }
+        ring.consume(4);
+        for (int i = 6; i < 10; i++) { ring.push(i); }
+
+        RingSpan<int> first;
+        RingSpan<int> second;
+        ring.readSpans(first, second);
+        CHECK(first.size == 4);
+        CHECK(second.size == 2);
+        CHECK(first.data[0] == 4);
+        CHECK(second.data[0] == 8);
+        CHECK(second.data[1] == 9);
+
+        ring.writeSpans(first, second);
+        CHECK(first.size == 2);
+        CHECK(second.size == 0);
+        first.data[0] = 10;
+        first.data[1] = 11;
+        ring.commit(2);
+        CHECK(ring.full());
+        CHECK(ring.back() == 11);
+        CHECK(ring[6] == 10);
+    }
+
+    SUBCASE("Bulk push and pop across the wrap point.") {
+        int in[12];
+        int out[12];
+        for (int i = 0; i < 12; i++) { in[i] = i; }
+        CHECK(ring.push(in, 6) == 6);
+        CHECK(ring.pop(out, 5) == 5);
+        CHECK(ring.push(in + 6, 6) == 6);
+        CHECK(ring.push(in, 12) == 1);
+        CHECK(ring.size() == 8);
+        CHECK(ring.pop(out, 12) == 8);
+        for (int i = 0; i < 7; i++) { CHECK(out[i] == i + 5); }
+        CHECK(out[7] == 0);
+        CHECK(ring.empty());
+    }
+
+    SUBCASE("Slots address the storage directly.") {
+        for (int i = 0; i < 11; i++) {
+            if (ring.full()) { ring.consume(1); }
+            ring.push(i);
+        }
+        CHECK(ring.slotOf(0) == 3);
+        CHECK(ring.atSlot(ring.slotOf(0)) == 3);
+        CHECK(ring.atSlot(ring.slotOf(7)) == 10);
+    }
+
+    SUBCASE("Clear.") {
+        for (int i = 0; i < 5; i++) { ring.push(i); }
+        ring.clear();
+        CHECK(ring.empty());
+        ring.push(42);
+        CHECK(ring.front() == 42);
+    }
+}
+
+TEST_CASE("Testing the runtime sized ring buffer.") {
+    RingBuffer<float, 0> ring(10);
+    CHECK(ring.valid());
+    CHECK(ring.capacity() == 16);
+
+    for (int i = 0; i < 40; i++) {
+        if (ring.size() == 10) { ring.consume(1); }
+        ring.push(i * 0.5);
+    }
+    CHECK(ring.size() == 10);
+    for (int i = 0; i < 10; i++) { CHECK(ring[i] == doctest::Approx((30 + i) * 0.5)); }
+
+    ring.release();
+    CHECK_FALSE(ring.valid());
+    CHECK_FALSE(ring.push(1.0));
+}
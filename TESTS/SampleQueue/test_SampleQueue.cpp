@@ -0,0 +1,131 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "../dep/doctest.h"
+#include "SampleQueue/SampleQueue.h"
+#include <thread>
+
+TEST_CASE("Testing the sample queue on one thread.") {
+    SampleQueue<float, 8> queue;
+
+    SUBCASE("Starts empty.") {
+        CHECK(queue.empty());
+        CHECK(queue.capacity() == 8);
+        float item = 0;
+        CHECK_FALSE(queue.pop(item));
+    }
+
+    SUBCASE("First in, first out.") {
+        for (int i = 0; i < 5; i++) { CHECK(queue.push(i)); }
+        CHECK(queue.size() == 5);
+        float item = -1;
+        CHECK(queue.pop(item));
+        CHECK(item == 0);
+        CHECK(queue.size() == 4);
+    }
+
+    SUBCASE("Overwrites the oldest items when full.") {
+        for (int i = 0; i < 8; i++) { CHECK(queue.push(i)); }
+        CHECK_FALSE(queue.push(8));
+        CHECK_FALSE(queue.push(9));
+        CHECK(queue.size() == 8);
+        float item = -1;
+        CHECK(queue.pop(item));
+        CHECK(item == 2);
+        CHECK(queue.getDropped() == 2);
+        CHECK(queue.push(10));
+    }
+
+    SUBCASE("Batch pops wrap around the storage.") {
+        float items[8];
+        for (int i = 0; i < 6; i++) { queue.push(i); }
+        CHECK(queue.pop(items, 8) == 6);
+        for (int i = 6; i < 12; i++) { queue.push(i); }
+
+        CHECK(queue.pop(items, 4) == 4);
+        CHECK(items[0] == 6);
+        CHECK(items[3] == 9);
+        CHECK(queue.pop(items, 8) == 2);
+        CHECK(items[1] == 11);
+        CHECK(queue.empty());
+        CHECK(queue.pop(items, 8) == 0);
+    }
+
+    SUBCASE("Batch pops after an overwrite return the newest items.") {
+        float items[8];
+        for (int i = 0; i < 20; i++) { queue.push(i); }
+        CHECK(queue.pop(items, 8) == 8);
+        CHECK(items[0] == 12);
+        CHECK(items[7] == 19);
+        CHECK(queue.getDropped() == 12);
+    }
+
+    SUBCASE("Discard.") {
+        for (int i = 0; i < 5; i++) { queue.push(i); }
+        queue.discard();
+        CHECK(queue.empty());
+        queue.push(42);
+        float item = 0;
+        CHECK(queue.pop(item));
+        CHECK(item == 42);
+    }
+}
+
+TEST_CASE("Stress testing the sample queue across two threads.") {
+    /* Both sides yield when they cannot make progress, so this also runs on
+       a single core. */
+    const uint32_t numItems = 2000000;
+    static SampleQueue<uint32_t, 64> queue;
+
+    SUBCASE("A producer that waits for room loses nothing.") {
+        std::thread producer([]() {
+            for (uint32_t i = 0; i < numItems; ++i) {
+                while (queue.size() == queue.capacity()) { std::this_thread::yield(); }
+                queue.push(i);
+            }
+        });
+
+        uint32_t expected = 0;
+        bool ordered = true;
+        while (expected < numItems) {
+            uint32_t items[16];
+            const size_t numPopped = queue.pop(items, 16);
+            for (size_t j = 0; j < numPopped; j++) {
+                ordered = ordered && (items[j] == expected);
+                ++expected;
+            }
+            if (numPopped == 0) { std::this_thread::yield(); }
+        }
+        producer.join();
+        CHECK(ordered);
+        CHECK(queue.empty());
+        CHECK(queue.getDropped() == 0);
+    }
+
+    SUBCASE("An overwriting producer never corrupts what is delivered.") {
+        /* The producer never waits, so it laps the consumer, sometimes while
+           the consumer is copying. Every delivered value must still be
+           newer than the last, and delivered plus dropped must account for
+           every push. */
+        const uint32_t dropsBefore = queue.getDropped();
+        std::thread producer([]() {
+            for (uint32_t i = 0; i < numItems; ++i) { queue.push(i); }
+        });
+
+        uint32_t delivered = 0;
+        uint32_t last = 0;
+        bool increasing = true;
+        while (queue.getDropped() - dropsBefore + delivered < numItems) {
+            uint32_t items[16];
+            const size_t numPopped = queue.pop(items, 16);
+            for (size_t j = 0; j < numPopped; j++) {
+                increasing = increasing && (delivered == 0 || items[j] > last);
+                last = items[j];
+                ++delivered;
+            }
+            if (numPopped == 0) { std::this_thread::yield(); }
+        }
+        producer.join();
+        CHECK(increasing);
+        CHECK(last == numItems - 1);
+        CHECK(delivered + queue.getDropped() - dropsBefore == numItems);
+    }
+}
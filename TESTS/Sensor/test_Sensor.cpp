@@ -1,33 +1,82 @@
-// #include "gtest/gtest.h"
-// #include "Sensor/Sensor.h"
-// #include "mbed/mbed.h"
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "../dep/doctest.h"
+#include <src/Sensor/Sensor.h>
+#include <src/Filter/SmaFilter.h>
+/* The runner only builds the sources next to the test. */
+#include <src/Filter/Filter.cpp>
+#include <src/InterruptDevice/InterruptDevice.cpp>
 
-// TEST(SensorTest, initialize) {
-//     Sensor s = Sensor(PA_0);
-//     EXPECT_EQ(s.get_value(),  0.0);
-// }
+/** Sensor whose handler queues a value set by the test. */
+class TestSensor final : public Sensor {
+    public:
+        TestSensor(Filter * filter) : mValue(0) { setFilter(SMA, filter); }
 
-// // TEST(FilterTest, read) {
-// //     Filter f = Filter();
-// //     f.addSample(10.0);
-// //     EXPECT_EQ(f.getResult(), 10.0);
-// // }
+        /** Runs the handler once, as the ticker interrupt would. */
+        void sample(const float value) {
+            mValue = value;
+            handler();
+        }
 
-// // TEST(FilterTest, readSeries) {
-// //     Filter f = Filter();
+        void clearHistory(void) override { resetFilter(); }
 
-// //     f.addSample(10.0);
-// //     EXPECT_EQ(f.getResult(), 10.0);
+    protected:
+        void handler(void) override { mSamples.push(mValue); }
 
-// //     f.addSample(11.0);
-// //     EXPECT_EQ(f.getResult(), 11.0);
+    private:
+        float mValue;
+};
 
-// //     f.addSample(12.0);
-// //     EXPECT_EQ(f.getResult(), 12.0);
+TEST_CASE("Testing the sensor sample path.") {
+    SUBCASE("Read while empty.") {
+        SmaFilter filter(4);
+        TestSensor sensor(&filter);
+        CHECK(sensor.getValue() == 0);
+        CHECK(sensor.getDroppedSamples() == 0);
+    }
 
-// //     f.addSample(13.0);
-// //     EXPECT_EQ(f.getResult(), 13.0);
+    SUBCASE("Reads filter the queued samples.") {
+        SmaFilter filter(4);
+        TestSensor sensor(&filter);
+        for (int i = 0; i < 4; i++) { sensor.sample(i); }
+        CHECK(sensor.getValue() == doctest::Approx(1.5));
+        sensor.sample(10);
+        CHECK(sensor.getValue() == doctest::Approx(4.0));
+    }
 
-// //     f.addSample(14.0);
-// //     EXPECT_EQ(f.getResult(), 14.0);
-// // }
+    SUBCASE("A late read follows the newest samples.") {
+        /* More samples than the queue holds arrive between reads; the
+           oldest are overwritten and counted. */
+        const int numSamples = 3 * SENSOR_QUEUE_SIZE;
+        SmaFilter filter(4);
+        TestSensor sensor(&filter);
+        for (int i = 0; i < numSamples; i++) { sensor.sample(i); }
+        CHECK(sensor.getValue() == doctest::Approx(numSamples - 2.5));
+        CHECK(sensor.getDroppedSamples() == numSamples - SENSOR_QUEUE_SIZE);
+
+        sensor.sample(1000);
+        CHECK(sensor.getValue() == doctest::Approx((3 * numSamples - 6 + 1000) / 4.0));
+    }
+
+    SUBCASE("Updates filter every sample between reads.") {
+        SmaFilter filter(256);
+        TestSensor sensor(&filter);
+        for (int i = 0; i < 200; i++) {
+            sensor.sample(i);
+            if (i % 50 == 49) { sensor.update(); }
+        }
+        CHECK(sensor.getDroppedSamples() == 0);
+        CHECK(sensor.getValue() == doctest::Approx(99.5));
+    }
+
+    SUBCASE("Clearing discards queued samples.") {
+        SmaFilter filter(4);
+        TestSensor sensor(&filter);
+        for (int i = 0; i < 8; i++) { sensor.sample(i); }
+        sensor.update();
+        sensor.sample(100);
+        sensor.clearHistory();
+        CHECK(sensor.getValue() == 0);
+        sensor.sample(7);
+        CHECK(sensor.getValue() == doctest::Approx(7.0));
+    }
+}
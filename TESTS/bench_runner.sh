@@ -0,0 +1,42 @@
+BUILD_ROOT="BUILD/"
+SRC_ROOT="../src/"
+
+# Auto generate benchmark executables
+
+# This find command checks for all files called bench_*
+# in the TESTS folder, recursively. For each file that's
+# found, make a new directory for it in BUILD, if it doesn't
+# exist, and then compile the executable there and run it.
+# Unlike the tests, benchmarks are built with optimizations.
+find . -name "bench_*.cpp" | while read file;
+do
+    echo "Generating benchmark for $file.";
+
+    # Extracting the directory and file name metadata.
+    DIR=${file%/*}
+    FILE=${file%.*}
+
+    # Build the directory if it exists (-p flag).
+    mkdir -p ${BUILD_ROOT}${DIR}
+
+    # Make the executable and place it in the new directory.
+    #   -O2 : Optimize like a release build.
+    #   The Filter implementation file is linked in for the base class.
+    g++ -O2 -Wall -Wextra                                       \
+        -o ${BUILD_ROOT}${FILE}                                 \
+        -I ${SRC_ROOT}                                          \
+        ${SRC_ROOT}Filter/*.cpp                                 \
+        ${file}                                                 ;
+
+    # While we're at it, let's execute it as well.
+    if [ -f ${BUILD_ROOT}${FILE} ]
+    then
+        echo "Executing benchmark:";
+        ./${BUILD_ROOT}${FILE};
+    else
+        echo "Didn't find an executable.";
+    fi
+
+    echo "$file benchmark Generated.";
+    echo "\n\n";
+done
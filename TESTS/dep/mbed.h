@@ -0,0 +1,75 @@
+/**
+ * Maximum Power Point Tracker Project
+ * 
+ * File: mbed.h
+ * Author: Matthew Yu
+ * Organization: UT Solar Vehicles Team
+ * Created on: October 17th, 2026
+ * Last Modified: 10/17/26
+ * 
+ * File Description: Host stand-ins for the few Mbed OS classes the sensor
+ * classes use, so they can be unit tested off target. Semaphore is a counting
+ * semaphore built on the standard library. Ticker only records its callback;
+ * tests call the handler directly instead of waiting on a timer.
+ */
+#pragma once
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+
+class Semaphore {
+    public:
+        Semaphore(const int32_t count = 0) : mCount(count) {}
+
+        void acquire(void) {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mCondition.wait(lock, [this]() { return mCount > 0; });
+            --mCount;
+        }
+
+        bool try_acquire(void) {
+            std::lock_guard<std::mutex> lock(mMutex);
+            if (mCount == 0) { return false; }
+            --mCount;
+            return true;
+        }
+
+        void release(void) {
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+                ++mCount;
+            }
+            mCondition.notify_one();
+        }
+
+    private:
+        std::mutex mMutex;
+        std::condition_variable mCondition;
+        int32_t mCount;
+};
+
+class CriticalSectionLock {};
+
+template <typename T>
+std::function<void(void)> callback(T * obj, void (T::*method)(void)) {
+    return [obj, method]() { (obj->*method)(); };
+}
+
+class Ticker {
+    public:
+        template <typename Rep, typename Period>
+        void attach(
+            const std::function<void(void)> & func,
+            const std::chrono::duration<Rep, Period> interval
+        ) {
+            mFunc = func;
+            (void) interval;
+        }
+
+        void detach(void) { mFunc = nullptr; }
+
+    private:
+        std::function<void(void)> mFunc;
+};
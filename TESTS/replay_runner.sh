@@ -0,0 +1,25 @@
+BUILD_ROOT="BUILD/"
+SRC_ROOT="../src/"
+
+# Build the trace replay tool and run it on a logged sensor trace.
+# Every argument is passed through, i.e.
+#   sh replay_runner.sh -c 1 traces/array_voltage.csv
+# See Replay/replay_Filters.cpp for the options and the output format.
+mkdir -p ${BUILD_ROOT}Replay
+
+# Make the executable like the benchmarks, with optimizations so the per
+# sample cost it reports is meaningful.
+#   -pthread : Configurations are replayed on a thread per core.
+g++ -O2 -Wall -Wextra                                           \
+    -o ${BUILD_ROOT}Replay/replay_Filters                       \
+    -I ${SRC_ROOT}                                              \
+    -pthread                                                    \
+    ${SRC_ROOT}Filter/*.cpp                                     \
+    Replay/replay_Filters.cpp                                   ;
+
+if [ -f ${BUILD_ROOT}Replay/replay_Filters ]
+then
+    ./${BUILD_ROOT}Replay/replay_Filters "$@";
+else
+    echo "Didn't find an executable.";
+fi
@@ -33,18 +33,22 @@ do
     #   -Wextra : Even more warnings.
     #   -o : Specifies the name and location of our executable.
     #   -I : Specifies a directory to be added to be searched for header files.
+    #        The repository root is searched too, for <src/...> includes.
+    #   -pthread : Links threading support, for the multithreaded stress tests.
     #   The last two arguments are the file to compile with the main, as well
     #   as all the files in the library added.
     if [ $count != 0 ]; then
         g++ -Wall -Wextra                                       \
             -o ${BUILD_ROOT}${FILE}                             \
-            -I ./dep -I ${SRC_ROOT}                             \
+            -I ./dep -I ${SRC_ROOT} -I ..                       \
+            -pthread                                            \
             ${SRC_ROOT}${DIR}/*.cpp                             \
             ${file}                                             ;
     else
         g++ -Wall -Wextra                                       \
             -o ${BUILD_ROOT}${FILE}                             \
-            -I ./dep -I ${SRC_ROOT}                             \
+            -I ./dep -I ${SRC_ROOT} -I ..                       \
+            -pthread                                            \
             ${file}                                             ;
     fi
 
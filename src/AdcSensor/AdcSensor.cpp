@@ -5,23 +5,56 @@
  * Author: Matthew Yu
  * Organization: UT Solar Vehicles Team
  * Created on: June 6th, 2021
- * Last Modified: 06/06/21
+ * Last Modified: 10/17/26
  * 
  * File Description: Describes the AdcSensor class, which is a derivative of the
  * Sensor class. It utilizes AnalogIn.
  */
 #include "AdcSensor.h"
 
-AdcSensor::AdcSensor(const PinName pin) : mSensor(pin) {}
+AdcSensor::AdcSensor(const PinName pin) :
+    mSensor(pin), mDecimator(nullptr), mBurst(1) {}
 
 void AdcSensor::clearHistory(void) {
-    mFilter->clear();
-    mSensorValue = 0;
+    {
+        /* The decimator belongs to the handler. */
+        CriticalSectionLock lock;
+        if (mDecimator != nullptr) mDecimator->clear();
+    }
+    resetFilter();
+}
+
+void AdcSensor::setOversampling(
+    const uint16_t samplesPerTick,
+    DecimatingFilter * decimator
+) {
+    /* The oversampling state belongs to the handler, which never waits on a
+       lock; keep it out while we swap it. */
+    CriticalSectionLock lock;
+    mBurst = samplesPerTick;
+    if (mBurst > ADC_MAX_BURST) mBurst = ADC_MAX_BURST;
+    if (mBurst == 0) mBurst = 1;
+    mDecimator = decimator;
+    if (mDecimator != nullptr) mDecimator->clear();
 }
 
 void AdcSensor::handler(void) {
-    if (!mSensorSem.try_acquire()) return;
-    mFilter->addSample(mSensor.read_voltage());
-    mSensorValue = mFilter->getResult();
-    mSensorSem.release();
+    float tempData;
+    if (readVoltage(tempData)) mSamples.push(tempData);
+}
+
+bool AdcSensor::readVoltage(float & voltage) {
+    if (mDecimator == nullptr) {
+        voltage = mSensor.read_voltage();
+        return true;
+    }
+
+    float burst[ADC_MAX_BURST];
+    for (uint16_t i = 0; i < mBurst; ++i) {
+        burst[i] = mSensor.read_voltage();
+    }
+    mDecimator->addSamples(burst, mBurst);
+    if (!mDecimator->isOutputReady()) return false;
+    voltage = mDecimator->readOutput();
+    return true;
 }
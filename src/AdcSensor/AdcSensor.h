@@ -5,14 +5,22 @@
  * Author: Matthew Yu
  * Organization: UT Solar Vehicles Team
  * Created on: June 6th, 2021
- * Last Modified: 06/08/21
+ * Last Modified: 10/17/26
  * 
  * File Description: Describes the AdcSensor class, which is a derivative of the
  * Sensor class. It utilizes AnalogIn.
+ * 
+ * An AdcSensor can optionally oversample: each handler call reads a burst of
+ * conversions into a DecimatingFilter, and the sensor filter only sees a new
+ * sample when the decimator completes a block.
  */
 #pragma once
 #include "mbed.h"
 #include <src/Sensor/Sensor.h>
+#include <src/Filter/DecimatingFilter.h>
+
+/** Maximum number of ADC conversions read per handler call. */
+#define ADC_MAX_BURST 32
 
 class AdcSensor : public Sensor {
     public:
@@ -25,10 +33,43 @@ class AdcSensor : public Sensor {
 
         void clearHistory(void) override;
 
+        /**
+         * Enables oversampling. Each handler call reads samplesPerTick
+         * conversions into the decimator; the sensor filter is only updated
+         * when the decimator emits an output.
+         * 
+         * @param[in] samplesPerTick Number of conversions read per handler
+         *                           call. Clamped to ADC_MAX_BURST.
+         * @param[in] decimator Decimating stage to feed. nullptr disables
+         *                      oversampling.
+         * @note Pick a decimation ratio that is a multiple of samplesPerTick,
+         *       so at most one output is produced per handler call. If a burst
+         *       completes several blocks, only the latest output is used.
+         */
+        void setOversampling(
+            const uint16_t samplesPerTick,
+            DecimatingFilter * decimator
+        );
+
     protected:
         /** Reads the sensor ADC value and converts it into something usable. */
         void handler(void) override;
 
+        /**
+         * Reads the next sensor voltage, through the decimator if oversampling
+         * is enabled.
+         * 
+         * @param[out] voltage Sensor voltage.
+         * @return Whether a new voltage is available for the sensor filter.
+         */
+        bool readVoltage(float & voltage);
+
     protected:
         AnalogIn mSensor;
+
+        /** Oversampling stage. nullptr when oversampling is disabled. */
+        DecimatingFilter * mDecimator;
+
+        /** Number of conversions read per handler call when oversampling. */
+        uint16_t mBurst;
 };
@@ -5,7 +5,7 @@
  * Author: Matthew Yu
  * Organization: UT Solar Vehicles Team
  * Created on: September 10th, 2020
- * Last Modified: 06/08/21
+ * Last Modified: 10/17/26
  * 
  * File Description: This header file implements the CurrentAdcSensor class,
  * which is derived from the AdcSensor class.
@@ -24,11 +24,10 @@ class CurrentAdcSensor final : public AdcSensor {
 
     private:
         void handler(void) override {
-            if (!mSensorSem.try_acquire()) return;
-            float tempData = mSensor.read_voltage();
-            /* TODO: insert calibration function here. */
-            mFilter->addSample(tempData);
-            mSensorValue = mFilter->getResult();
-            mSensorSem.release();
+            float tempData;
+            if (readVoltage(tempData)) {
+                /* TODO: insert calibration function here. */
+                mSamples.push(tempData);
+            }
         }
 };
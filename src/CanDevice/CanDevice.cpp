@@ -5,7 +5,7 @@
  * Author: Matthew Yu
  * Organization: UT Solar Vehicles Team
  * Created on: September 10th, 2020
- * Last Modified: 06/05/21
+ * Last Modified: 10/17/26
  *
  * File Description: This file manages the CAN class, abstracting away
  * implementation logic to send and receive messages via the CAN lines and
@@ -19,8 +19,6 @@
 CanDevice::CanDevice(
     const PinName pinTx, 
     const PinName pinRx) : mCan(pinRx, pinTx, CAN_BUS_BAUD_RATE) {
-    mGetIdx = 0;
-    mPutIdx = 0;
     mMailboxSem = new Semaphore(1);
 }
 
@@ -36,17 +34,17 @@ bool CanDevice::sendMessage(Message* message) {
 bool CanDevice::getMessage(Message* message) {
     mMailboxSem->acquire();
 
-    if (isBufferEmpty(mGetIdx, mPutIdx)) {
+    if (mMailbox.empty()) {
         mMailboxSem->release();
         return false;
     } else {
         /* Copy each field over. We assume the data is in chars. */
-        message->setMessageID(mMailbox[mGetIdx].id);
-        unsigned char* data = &(mMailbox[mGetIdx].data[0]);
+        const CANMessage& msg = mMailbox.front();
+        message->setMessageID(msg.id);
         message->setMessageDataC(
-            reinterpret_cast<const char*>(data), 
-            mMailbox[mGetIdx].len);
-        mGetIdx = (mGetIdx + 1) % CAN_BUS_SIZE;
+            reinterpret_cast<const char*>(&(msg.data[0])), 
+            msg.len);
+        mMailbox.consume(1);
 
         mMailboxSem->release();
         return true;
@@ -63,12 +61,15 @@ CanDevice::~CanDevice(void) { delete mMailboxSem; }
 
 void CanDevice::handler(void) {
     if (!mMailboxSem->try_acquire()) return;
-    if (!isBufferFull(mGetIdx, mPutIdx)) {
-        /* If bus buffer is free, read a new byte. */
-        mCan.read(mMailbox[mPutIdx]);
+    RingSpan<CANMessage> space;
+    RingSpan<CANMessage> wrapped;
+    mMailbox.writeSpans(space, wrapped);
+    if (space.size > 0) {
+        /* If bus buffer is free, read a new message in place. */
+        mCan.read(space.data[0]);
         /* Ignore msg IDs that don't match our accept list. */
-        if (checkId(mMailbox[mPutIdx].id)) {
-            mPutIdx = (mPutIdx + 1) % CAN_BUS_SIZE;
+        if (checkId(space.data[0].id)) {
+            mMailbox.commit(1);
         }
     }
     mMailboxSem->release();
@@ -81,13 +82,3 @@ bool CanDevice::checkId(const uint16_t id) const {
     }
     return false;
 }
-
-inline bool CanDevice::isBufferFull(const uint16_t readIdx, const uint16_t writeIdx) const {
-    if (readIdx == (writeIdx + 1) % CAN_BUS_SIZE) return true;
-    else return false;
-}
-
-inline bool CanDevice::isBufferEmpty(const uint16_t readIdx, const uint16_t writeIdx) const {
-    if (readIdx == writeIdx) return true;
-    else return false;
-}
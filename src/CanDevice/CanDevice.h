@@ -5,7 +5,7 @@
  * Author: Matthew Yu
  * Organization: UT Solar Vehicles Team
  * Created on: September 12th, 2020
- * Last Modified: 06/08/21
+ * Last Modified: 10/17/26
  * 
  * File Description: This header file describes the CanDevice class, which is a
  * concrete class that defines a clear read/write API for handling communication
@@ -15,9 +15,11 @@
 #include "mbed.h"
 #include <src/InterruptDevice/InterruptDevice.h>
 #include <src/Message/Message.h>
+#include <src/RingBuffer/RingBuffer.h>
 #include <set>
 
-#define CAN_BUS_SIZE 50
+/** Mailbox size. Must be a power of two. */
+#define CAN_BUS_SIZE 64
 #define CAN_BUS_BAUD_RATE 500000
 
 class CanDevice final : public InterruptDevice {
@@ -60,9 +62,6 @@ class CanDevice final : public InterruptDevice {
         /** Reads a CANmessage and puts it into the mailbox. */
         void handler() override;
 
-        inline bool isBufferFull(const uint16_t readIdx, const uint16_t writeIdx) const;
-        inline bool isBufferEmpty(const uint16_t readIdx, const uint16_t writeIdx) const;
-
         /**
          * Checks the ID against a list of CAN ids. If it matches we return
          * success.
@@ -75,15 +74,11 @@ class CanDevice final : public InterruptDevice {
     private:
         /* Can object and buffer for messages. */
         CAN mCan;
-        CANMessage mMailbox[CAN_BUS_SIZE];
+        RingBuffer<CANMessage, CAN_BUS_SIZE> mMailbox;
 
         /** Lock for the mailbox. I hope you have a key. */
         Semaphore *mMailboxSem;
 
-        /** Indices for traversing the mailbox. */
-        uint16_t mGetIdx;
-        uint16_t mPutIdx;
-
         /** Set of CAN IDs to retain. */
         std::set<uint16_t> mFilterList;
 };
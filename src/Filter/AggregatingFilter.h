@@ -0,0 +1,323 @@
+/**
+ * Maximum Power Point Tracker Project
+ * 
+ * File: AggregatingFilter.h
+ * Author: Matthew Yu
+ * Organization: UT Solar Vehicles Team
+ * Created on: October 17th, 2026
+ * Last Modified: 10/17/26
+ * 
+ * File Description: This header file implements the AggregatingFilter class,
+ * which is a derived class from the parent Filter class. Like the
+ * DecimatingFilter, it consumes blocks of input samples and emits one output
+ * per block, but the output is a BlockSummary (min, max, mean, last sample and
+ * sample count) rather than just the average. This lets telemetry be sent at a
+ * fraction of the sampling rate (i.e. one record per 100 samples) without
+ * hiding spikes inside a block.
+ * 
+ * A block closes once it holds blockSize samples, or early when closeBlock is
+ * called, i.e. from a telemetry timer. BlockSummary::pack quantizes a summary
+ * into the 64 bit payload of a Message:
+ * 
+ *     Message msg(id, summary.pack(0.01f, 0.0f));
+ * 
+ * Snapshots hold the partial block and the last summary.
+ */
+#pragma once
+#include "Filter.h"
+#include "FilterState.h"
+
+/** Bits used by each value of a packed BlockSummary. */
+#define BLOCK_SUMMARY_VALUE_BITS 14
+
+/** Bits used by the sample count of a packed BlockSummary. */
+#define BLOCK_SUMMARY_COUNT_BITS 8
+
+/** Summary of one block of samples. */
+struct BlockSummary {
+    float min;
+    float max;
+    float mean;
+    /** Most recent sample of the block. */
+    float last;
+    /** Number of samples in the block. */
+    uint16_t count;
+
+    /**
+     * Packs the summary into a Message payload. From the least significant
+     * bit: count (8 bits, saturated), min, max, mean and last (14 bits each).
+     * Values are stored as unsigned codes, (value - offset) / lsb rounded to
+     * the nearest code and clamped to [0, 16383].
+     * 
+     * @param[in] lsb Value of one code, i.e. 0.01 for 10 mV steps.
+     * @param[in] offset Value of code 0.
+     * @return Packed summary.
+     * @precondition lsb is a positive number.
+     */
+    uint64_t pack(const float lsb, const float offset) const {
+        const uint16_t maxCount = (1 << BLOCK_SUMMARY_COUNT_BITS) - 1;
+        uint64_t packed = (count > maxCount) ? maxCount : count;
+        packed |= (uint64_t) toCode(min, lsb, offset) << BLOCK_SUMMARY_COUNT_BITS;
+        packed |= (uint64_t) toCode(max, lsb, offset)
+            << (BLOCK_SUMMARY_COUNT_BITS + BLOCK_SUMMARY_VALUE_BITS);
+        packed |= (uint64_t) toCode(mean, lsb, offset)
+            << (BLOCK_SUMMARY_COUNT_BITS + 2 * BLOCK_SUMMARY_VALUE_BITS);
+        packed |= (uint64_t) toCode(last, lsb, offset)
+            << (BLOCK_SUMMARY_COUNT_BITS + 3 * BLOCK_SUMMARY_VALUE_BITS);
+        return packed;
+    }
+
+    /**
+     * Unpacks a summary written by pack.
+     * 
+     * @param[in] packed Packed summary.
+     * @param[in] lsb Value of one code, as passed to pack.
+     * @param[in] offset Value of code 0, as passed to pack.
+     * @return Summary, quantized to lsb.
+     */
+    static BlockSummary unpack(const uint64_t packed, const float lsb, const float offset) {
+        const uint64_t mask = (1 << BLOCK_SUMMARY_VALUE_BITS) - 1;
+        BlockSummary summary;
+        summary.count = packed & ((1 << BLOCK_SUMMARY_COUNT_BITS) - 1);
+        summary.min = offset + lsb * (float) ((packed >> BLOCK_SUMMARY_COUNT_BITS) & mask);
+        summary.max = offset + lsb * (float) ((packed
+            >> (BLOCK_SUMMARY_COUNT_BITS + BLOCK_SUMMARY_VALUE_BITS)) & mask);
+        summary.mean = offset + lsb * (float) ((packed
+            >> (BLOCK_SUMMARY_COUNT_BITS + 2 * BLOCK_SUMMARY_VALUE_BITS)) & mask);
+        summary.last = offset + lsb * (float) ((packed
+            >> (BLOCK_SUMMARY_COUNT_BITS + 3 * BLOCK_SUMMARY_VALUE_BITS)) & mask);
+        return summary;
+    }
+
+    /**
+     * Quantizes a value to a packed code.
+     * 
+     * @param[in] value Value to quantize.
+     * @param[in] lsb Value of one code.
+     * @param[in] offset Value of code 0.
+     * @return Nearest code, clamped to [0, 16383].
+     */
+    static uint16_t toCode(const float value, const float lsb, const float offset) {
+        const float code = (value - offset) / lsb + 0.5f;
+        const float maxCode = (1 << BLOCK_SUMMARY_VALUE_BITS) - 1;
+        if (!(code > 0)) { return 0; }
+        if (code >= maxCode) { return (uint16_t) maxCode; }
+        return (uint16_t) code;
+    }
+};
+
+class AggregatingFilter final : public Filter {
+    public:
+        /** Default constructor for an AggregatingFilter object. Block of 10. */
+        AggregatingFilter(void) : Filter(10) { clear(); }
+
+        /**
+         * Constructor for an AggregatingFilter object.
+         * 
+         * @param[in] blockSize Number of input samples summarized into each
+         *                      output.
+         * @precondition blockSize is a positive number.
+         */
+        AggregatingFilter(const uint16_t blockSize) : Filter(blockSize) { clear(); }
+
+        void addSample(const float sample) override {
+            if (mCount == 0 || sample < mMin) { mMin = sample; }
+            if (mCount == 0 || sample > mMax) { mMax = sample; }
+            mSum += sample;
+            mLast = sample;
+            if (++mCount == mMaxSamples) { emit(); }
+        }
+
+        void addSamples(const float * samples, const size_t numSamples) override {
+            consume(samples, numSamples, nullptr);
+        }
+
+        /**
+         * Pushes a burst of input samples and collects the summaries of the
+         * blocks it completes.
+         * 
+         * @param[in] samples Pointer to the input values.
+         * @param[in] numSamples Number of input values.
+         * @param[out] outputs Pointer to an array with room for at least
+         *                     numSamples / blockSize + 1 summaries.
+         * @return Number of summaries written.
+         */
+        size_t aggregate(
+            const float * samples,
+            const size_t numSamples,
+            BlockSummary * outputs
+        ) {
+            return consume(samples, numSamples, outputs);
+        }
+
+        /**
+         * Closes the current block early, i.e. when a telemetry period ends
+         * before blockSize samples arrived.
+         * 
+         * @return Whether a block was closed. Empty blocks are not.
+         */
+        bool closeBlock(void) {
+            if (mCount == 0) { return false; }
+            emit();
+            return true;
+        }
+
+        /** Returns the mean of the most recently closed block. */
+        float getResult(void) const override { return mCurrentVal; }
+
+        /** Returns the summary of the most recently closed block. */
+        BlockSummary getSummary(void) const { return mSummary; }
+
+        /**
+         * Returns whether a block was closed since the last call to
+         * readOutput.
+         */
+        bool isOutputReady(void) const { return mReady; }
+
+        /**
+         * Returns the summary of the most recently closed block and lowers the
+         * ready flag.
+         * 
+         * @return Block summary.
+         */
+        BlockSummary readOutput(void) {
+            mReady = false;
+            return mSummary;
+        }
+
+        /** Returns the block size. */
+        uint16_t getBlockSize(void) const { return mMaxSamples; }
+
+        void clear(void) override {
+            reset();
+            mSummary = BlockSummary{0, 0, 0, 0, 0};
+            mReady = false;
+            mCurrentVal = 0;
+        }
+
+        size_t serialize(uint8_t * buffer, const size_t len) const override {
+            FilterStateWriter writer(buffer, len, FilterState::AGGREGATING);
+            writer.put(mMin);
+            writer.put(mMax);
+            writer.put(mSum);
+            writer.put(mLast);
+            writer.put(mCount);
+            writer.put(mSummary);
+            writer.put(mReady);
+            return writer.finish();
+        }
+
+        bool deserialize(const uint8_t * buffer, const size_t len) override {
+            FilterStateReader reader(buffer, len, FilterState::AGGREGATING);
+            float min = 0;
+            float max = 0;
+            float sum = 0;
+            float last = 0;
+            uint16_t count = 0;
+            BlockSummary summary{0, 0, 0, 0, 0};
+            bool ready = false;
+            reader.get(min);
+            reader.get(max);
+            reader.get(sum);
+            reader.get(last);
+            reader.get(count);
+            reader.get(summary);
+            reader.get(ready);
+            /* A partial block from a larger block size would never close. */
+            if (!reader.isValid() || count >= mMaxSamples) { return false; }
+            mMin = min;
+            mMax = max;
+            mSum = sum;
+            mLast = last;
+            mCount = count;
+            mSummary = summary;
+            mCurrentVal = summary.mean;
+            mReady = ready;
+            return true;
+        }
+
+    private:
+        /** Starts a new, empty block. */
+        inline void reset(void) {
+            mMin = 0;
+            mMax = 0;
+            mSum = 0;
+            mLast = 0;
+            mCount = 0;
+        }
+
+        /**
+         * Accumulates samples block by block, scanning up to each block
+         * boundary without per sample checks.
+         * 
+         * @param[in] samples Pointer to the input values.
+         * @param[in] numSamples Number of input values.
+         * @param[out] outputs Where completed summaries are written. May be
+         *                     null.
+         * @return Number of summaries completed.
+         */
+        size_t consume(const float * samples, const size_t numSamples, BlockSummary * outputs) {
+            size_t numOutputs = 0;
+            size_t i = 0;
+            while (i < numSamples) {
+                size_t run = mMaxSamples - mCount;
+                if (run > numSamples - i) { run = numSamples - i; }
+
+                /* Keep the block state in locals so it stays in registers. */
+                float min = (mCount == 0) ? samples[i] : mMin;
+                float max = (mCount == 0) ? samples[i] : mMax;
+                float sum = mSum;
+                for (size_t j = 0; j < run; ++j) {
+                    const float sample = samples[i + j];
+                    min = (sample < min) ? sample : min;
+                    max = (sample > max) ? sample : max;
+                    sum += sample;
+                }
+                mMin = min;
+                mMax = max;
+                mSum = sum;
+                mLast = samples[i + run - 1];
+                mCount += run;
+                i += run;
+
+                if (mCount == mMaxSamples) {
+                    emit();
+                    if (outputs != nullptr) { outputs[numOutputs] = mSummary; }
+                    ++numOutputs;
+                }
+            }
+            return numOutputs;
+        }
+
+        /** Closes the current block. */
+        inline void emit(void) {
+            mSummary.min = mMin;
+            mSummary.max = mMax;
+            mSummary.mean = mSum / mCount;
+            mSummary.last = mLast;
+            mSummary.count = mCount;
+            mCurrentVal = mSummary.mean;
+            mReady = true;
+            reset();
+        }
+
+    private:
+        /** Summary of the most recently closed block. */
+        BlockSummary mSummary;
+
+        /** Running minimum and maximum of the current block. */
+        float mMin;
+        float mMax;
+
+        /** Sum of the current block. */
+        float mSum;
+
+        /** Most recent sample of the current block. */
+        float mLast;
+
+        /** Number of samples in the current block. */
+        uint16_t mCount;
+
+        /** Whether a block was closed and not yet read. */
+        bool mReady;
+};
@@ -0,0 +1,242 @@
+/**
+ * Maximum Power Point Tracker Project
+ * 
+ * File: AlphaBetaFilter.h
+ * Author: Matthew Yu
+ * Organization: UT Solar Vehicles Team
+ * Created on: October 17th, 2026
+ * Last Modified: 10/17/26
+ * 
+ * File Description: This header file implements the AlphaBetaFilter class,
+ * which is a derived class from the parent Filter class. It tracks a position
+ * and its rate (and, with a nonzero gamma, its acceleration) with fixed gains,
+ * so it follows trends without the lag of an EmaFilter at a fraction of the
+ * cost of a KalmanFilterN: each sample predicts forward by dt and corrects by
+ * the residual r = z - x_pred:
+ * 
+ *     x += alpha r,  v += beta r / dt,  a += 2 gamma r / dt^2
+ * 
+ * The time step may be given per sample, i.e. for a sensor read at uneven
+ * intervals. Larger gains track faster and smooth less. To pick beta from
+ * alpha, benedictBordnerBeta balances transient error against noise, giving a
+ * slightly underdamped response that rings, while criticallyDampedBeta puts
+ * both poles at the same real value, so errors decay without ringing.
+ * 
+ * Source: https://en.wikipedia.org/wiki/Alpha_beta_filter
+ */
+#pragma once
+#include "Filter.h"
+#include "FilterState.h"
+#include "ConstexprMath.h"
+
+class AlphaBetaFilter final : public Filter {
+    public:
+        /** Default constructor for an AlphaBetaFilter object. */
+        AlphaBetaFilter(void) : Filter(1) { init(0.5, benedictBordnerBeta(0.5), 0, 1); }
+
+        /**
+         * Constructor for an AlphaBetaFilter object.
+         * 
+         * @param[in] alpha Position gain, in (0, 1].
+         * @param[in] beta Rate gain, in (0, 2).
+         * @param[in] gamma Acceleration gain. 0 tracks position and rate only.
+         * @param[in] timeStep Default time between samples, in seconds.
+         * @precondition timeStep is a positive number.
+         */
+        AlphaBetaFilter(
+            const float alpha,
+            const float beta,
+            const float gamma = 0,
+            const float timeStep = 1
+        ) : Filter(1) { init(alpha, beta, gamma, timeStep); }
+
+        /**
+         * Returns the rate gain of the Benedict-Bordner relation,
+         * beta = alpha^2 / (2 - alpha), which minimizes the sum of the noise
+         * variance and the transient error for a position gain. The response
+         * is slightly underdamped, not critically damped.
+         * 
+         * @param[in] alpha Position gain, in (0, 1].
+         * @return Rate gain.
+         */
+        static constexpr float benedictBordnerBeta(const float alpha) {
+            return alpha * alpha / (2 - alpha);
+        }
+
+        /**
+         * Returns the rate gain giving a critically damped response for a
+         * position gain. Both gains then follow from one damping parameter
+         * theta, the double pole of the filter: alpha = 1 - theta^2 and
+         * beta = (1 - theta)^2.
+         * 
+         * @param[in] alpha Position gain, in (0, 1].
+         * @return Rate gain.
+         */
+        static constexpr float criticallyDampedBeta(const float alpha) {
+            return (float) ((1 - ConstexprMath::sqrt(1.0 - alpha))
+                * (1 - ConstexprMath::sqrt(1.0 - alpha)));
+        }
+
+        /** Adds a sample taken one default time step after the last one. */
+        void addSample(const float sample) override {
+            update(sample, mDt, mInvDt, mX, mV, mA);
+        }
+
+        /**
+         * Adds a sample taken timeStep seconds after the last one.
+         * 
+         * @param[in] sample Input value.
+         * @param[in] timeStep Time since the last sample, in seconds.
+         * @precondition timeStep is a positive number.
+         */
+        void addSample(const float sample, const float timeStep) {
+            update(sample, timeStep, 1.0f / timeStep, mX, mV, mA);
+        }
+
+        void addSamples(const float * samples, const size_t numSamples) override {
+            /* Keep the state in locals so it stays in registers. */
+            float x = mX;
+            float v = mV;
+            float a = mA;
+            for (size_t i = 0; i < numSamples; ++i) {
+                update(samples[i], mDt, mInvDt, x, v, a);
+            }
+            mX = x;
+            mV = v;
+            mA = a;
+        }
+
+        void filterSamples(
+            const float * samples,
+            float * results,
+            const size_t numSamples
+        ) override {
+            float x = mX;
+            float v = mV;
+            float a = mA;
+            for (size_t i = 0; i < numSamples; ++i) {
+                update(samples[i], mDt, mInvDt, x, v, a);
+                results[i] = x;
+            }
+            mX = x;
+            mV = v;
+            mA = a;
+        }
+
+        /** Returns the position estimate. */
+        float getResult(void) const override { return mX; }
+
+        /** Returns the rate estimate, in units per second. */
+        float getRate(void) const { return mV; }
+
+        /** Returns the acceleration estimate. 0 unless gamma is nonzero. */
+        float getAcceleration(void) const { return mA; }
+
+        /**
+         * Updates the default time between samples.
+         * 
+         * @param[in] timeStep Time between samples, in seconds.
+         * @precondition timeStep is a positive number.
+         */
+        void setTimeStep(const float timeStep) {
+            mDt = timeStep;
+            mInvDt = 1.0f / timeStep;
+        }
+
+        /** Resets the estimates. The next sample seeds the position. */
+        void clear(void) override {
+            mX = 0;
+            mV = 0;
+            mA = 0;
+            mSeeded = false;
+        }
+
+        size_t serialize(uint8_t * buffer, const size_t len) const override {
+            FilterStateWriter writer(buffer, len, FilterState::ALPHA_BETA);
+            writer.put(mX);
+            writer.put(mV);
+            writer.put(mA);
+            writer.put((uint8_t) mSeeded);
+            return writer.finish();
+        }
+
+        bool deserialize(const uint8_t * buffer, const size_t len) override {
+            FilterStateReader reader(buffer, len, FilterState::ALPHA_BETA);
+            float x = 0;
+            float v = 0;
+            float a = 0;
+            uint8_t seeded = 0;
+            reader.get(x);
+            reader.get(v);
+            reader.get(a);
+            reader.get(seeded);
+            if (!reader.isValid()) { return false; }
+            mX = x;
+            mV = v;
+            mA = a;
+            mSeeded = seeded != 0;
+            return true;
+        }
+
+    private:
+        void init(const float alpha, const float beta, const float gamma, const float timeStep) {
+            mAlpha = alpha;
+            mBeta = beta;
+            mGamma2 = 2 * gamma;
+            setTimeStep(timeStep);
+            clear();
+        }
+
+        /**
+         * Runs a single predict/correct step.
+         * 
+         * @param[in] sample Input value.
+         * @param[in] dt Time since the last sample.
+         * @param[in] invDt Reciprocal of dt.
+         * @param[in,out] x Position estimate.
+         * @param[in,out] v Rate estimate.
+         * @param[in,out] a Acceleration estimate.
+         */
+        inline void update(
+            const float sample,
+            const float dt,
+            const float invDt,
+            float & x,
+            float & v,
+            float & a
+        ) {
+            if (!mSeeded) {
+                x = sample;
+                mSeeded = true;
+                return;
+            }
+
+            /* Predict. */
+            x += dt * (v + 0.5f * dt * a);
+            v += dt * a;
+
+            /* Correct. */
+            const float r = sample - x;
+            x += mAlpha * r;
+            v += mBeta * invDt * r;
+            a += mGamma2 * invDt * invDt * r;
+        }
+
+    private:
+        /** Position, rate and acceleration estimates. */
+        float mX;
+        float mV;
+        float mA;
+
+        /** Gains. mGamma2 holds twice the gamma gain. */
+        float mAlpha;
+        float mBeta;
+        float mGamma2;
+
+        /** Default time step and its reciprocal. */
+        float mDt;
+        float mInvDt;
+
+        /** Whether the position has been seeded by a first sample. */
+        bool mSeeded;
+};
@@ -0,0 +1,299 @@
+/**
+ * Maximum Power Point Tracker Project
+ * 
+ * File: BiquadCascadeFilter.h
+ * Author: Matthew Yu
+ * Organization: UT Solar Vehicles Team
+ * Created on: October 17th, 2026
+ * Last Modified: 10/17/26
+ * 
+ * File Description: This header file implements the BiquadCascadeFilter class,
+ * which is a derived class from the parent Filter class. It runs a cascade of
+ * second order IIR sections in transposed direct form II, which is frequency
+ * selective (i.e. notching out switching converter ripple) with far less group
+ * delay than a long SMA window.
+ * 
+ * The BiquadDesign class generates section coefficients from a cutoff and a
+ * sample rate. Every design function is constexpr, so coefficient tables can
+ * be computed at compile time:
+ * 
+ *     constexpr auto lowPass = BiquadDesign::butterworthLowPass<2>(100, 10000);
+ *     BiquadCascadeFilter<2> filter(lowPass);
+ * 
+ * Snapshots hold the delay state of each section and the output.
+ * 
+ * Sources:
+ * https://www.w3.org/TR/audio-eq-cookbook/
+ * https://www.ti.com/lit/an/sloa049b/sloa049b.pdf (Bessel section table)
+ */
+#pragma once
+#include "Filter.h"
+#include "FilterState.h"
+#include "ConstexprMath.h"
+
+/** Coefficients of a single second order section, normalized so a0 = 1. */
+struct BiquadCoefficients {
+    float b0 = 1;
+    float b1 = 0;
+    float b2 = 0;
+    float a1 = 0;
+    float a2 = 0;
+};
+
+/** Coefficients of a cascade of second order sections. */
+template <size_t Sections>
+struct BiquadCascadeCoefficients {
+    BiquadCoefficients section[Sections];
+};
+
+class BiquadDesign final {
+    public:
+        /**
+         * Designs a Butterworth low pass filter of order 2 * Sections.
+         * 
+         * @param[in] cutoff -3 dB frequency, in Hz.
+         * @param[in] sampleRate Sample rate, in Hz.
+         * @return Section coefficients.
+         * @precondition 0 < cutoff < sampleRate / 2.
+         */
+        template <size_t Sections>
+        static constexpr BiquadCascadeCoefficients<Sections> butterworthLowPass(
+            const double cutoff,
+            const double sampleRate
+        ) {
+            static_assert(Sections > 0, "A cascade needs at least one section.");
+            BiquadCascadeCoefficients<Sections> coeffs{};
+            for (size_t k = 0; k < Sections; ++k) {
+                /* Pole pair k of an order 2N Butterworth prototype. */
+                const double q = 1.0 / (2.0 * ConstexprMath::sin(
+                    (2.0 * k + 1.0) * ConstexprMath::PI / (4.0 * Sections)));
+                coeffs.section[k] = lowPass(cutoff, sampleRate, q);
+            }
+            return coeffs;
+        }
+
+        /**
+         * Designs a Bessel low pass filter of order 2 * Sections, with maximally
+         * flat group delay. Each section is prewarped at its own natural
+         * frequency, which is accurate while the cutoff is well below Nyquist.
+         * 
+         * @param[in] cutoff -3 dB frequency, in Hz.
+         * @param[in] sampleRate Sample rate, in Hz.
+         * @return Section coefficients.
+         * @precondition 0 < 2.2 * cutoff < sampleRate / 2.
+         */
+        template <size_t Sections>
+        static constexpr BiquadCascadeCoefficients<Sections> besselLowPass(
+            const double cutoff,
+            const double sampleRate
+        ) {
+            static_assert(Sections > 0 && Sections <= 4,
+                "Bessel designs are tabulated for 1 to 4 sections.");
+            BiquadCascadeCoefficients<Sections> coeffs{};
+            for (size_t k = 0; k < Sections; ++k) {
+                coeffs.section[k] = lowPass(
+                    cutoff * besselFrequency(Sections, k),
+                    sampleRate,
+                    besselQ(Sections, k));
+            }
+            return coeffs;
+        }
+
+        /**
+         * Designs a notch filter.
+         * 
+         * @param[in] center Frequency to reject, in Hz.
+         * @param[in] sampleRate Sample rate, in Hz.
+         * @param[in] q Quality factor. Higher is narrower.
+         * @return Section coefficients.
+         * @precondition 0 < center < sampleRate / 2.
+         */
+        static constexpr BiquadCascadeCoefficients<1> notch(
+            const double center,
+            const double sampleRate,
+            const double q
+        ) {
+            const double w0 = 2.0 * ConstexprMath::PI * center / sampleRate;
+            const double cosW0 = ConstexprMath::cos(w0);
+            const double alpha = ConstexprMath::sin(w0) / (2.0 * q);
+            const double a0 = 1.0 + alpha;
+            BiquadCascadeCoefficients<1> coeffs{};
+            coeffs.section[0].b0 = (float) (1.0 / a0);
+            coeffs.section[0].b1 = (float) (-2.0 * cosW0 / a0);
+            coeffs.section[0].b2 = (float) (1.0 / a0);
+            coeffs.section[0].a1 = (float) (-2.0 * cosW0 / a0);
+            coeffs.section[0].a2 = (float) ((1.0 - alpha) / a0);
+            return coeffs;
+        }
+
+        /**
+         * Joins two cascades, i.e. a low pass followed by a notch.
+         * 
+         * @param[in] first Sections run first.
+         * @param[in] second Sections run after.
+         * @return Combined section coefficients.
+         */
+        template <size_t A, size_t B>
+        static constexpr BiquadCascadeCoefficients<A + B> cascade(
+            const BiquadCascadeCoefficients<A> & first,
+            const BiquadCascadeCoefficients<B> & second
+        ) {
+            BiquadCascadeCoefficients<A + B> coeffs{};
+            for (size_t k = 0; k < A; ++k) { coeffs.section[k] = first.section[k]; }
+            for (size_t k = 0; k < B; ++k) { coeffs.section[A + k] = second.section[k]; }
+            return coeffs;
+        }
+
+    private:
+        /**
+         * Designs a second order low pass section by the bilinear transform,
+         * prewarped at its natural frequency.
+         */
+        static constexpr BiquadCoefficients lowPass(
+            const double frequency,
+            const double sampleRate,
+            const double q
+        ) {
+            const double w0 = 2.0 * ConstexprMath::PI * frequency / sampleRate;
+            const double cosW0 = ConstexprMath::cos(w0);
+            const double alpha = ConstexprMath::sin(w0) / (2.0 * q);
+            const double a0 = 1.0 + alpha;
+            BiquadCoefficients coeffs{};
+            coeffs.b0 = (float) ((1.0 - cosW0) / 2.0 / a0);
+            coeffs.b1 = (float) ((1.0 - cosW0) / a0);
+            coeffs.b2 = (float) ((1.0 - cosW0) / 2.0 / a0);
+            coeffs.a1 = (float) (-2.0 * cosW0 / a0);
+            coeffs.a2 = (float) ((1.0 - alpha) / a0);
+            return coeffs;
+        }
+
+        /** Natural frequency of a Bessel section, relative to the -3 dB cutoff. */
+        static constexpr double besselFrequency(const size_t sections, const size_t k) {
+            switch (sections * 10 + k) {
+                case 10: return 1.2736;
+                case 20: return 1.4192;
+                case 21: return 1.5912;
+                case 30: return 1.6060;
+                case 31: return 1.6913;
+                case 32: return 1.9071;
+                case 40: return 1.7837;
+                case 41: return 1.8376;
+                case 42: return 1.9591;
+                case 43: return 2.1953;
+                default: return 1.0;
+            }
+        }
+
+        /** Quality factor of a Bessel section. */
+        static constexpr double besselQ(const size_t sections, const size_t k) {
+            switch (sections * 10 + k) {
+                case 10: return 0.5773;
+                case 20: return 0.5219;
+                case 21: return 0.8055;
+                case 30: return 0.5103;
+                case 31: return 0.6112;
+                case 32: return 1.0234;
+                case 40: return 0.5060;
+                case 41: return 0.5596;
+                case 42: return 0.7109;
+                case 43: return 1.2258;
+                default: return 0.7071;
+            }
+        }
+};
+
+/**
+ * @tparam Sections Number of second order sections in the cascade.
+ */
+template <size_t Sections>
+class BiquadCascadeFilter final : public Filter {
+    static_assert(Sections > 0, "A cascade needs at least one section.");
+
+    public:
+        /**
+         * Constructor for a BiquadCascadeFilter object.
+         * 
+         * @param[in] coeffs Section coefficients, i.e. from BiquadDesign.
+         */
+        constexpr BiquadCascadeFilter(const BiquadCascadeCoefficients<Sections> & coeffs) :
+            Filter(Sections), mCoeffs(coeffs), mS1{}, mS2{} {}
+
+        void addSample(const float sample) override { mCurrentVal = step(sample); }
+
+        void addSamples(const float * samples, const size_t numSamples) override {
+            float val = mCurrentVal;
+            for (size_t i = 0; i < numSamples; ++i) { val = step(samples[i]); }
+            mCurrentVal = val;
+        }
+
+        void filterSamples(
+            const float * samples,
+            float * results,
+            const size_t numSamples
+        ) override {
+            for (size_t i = 0; i < numSamples; ++i) { results[i] = step(samples[i]); }
+            if (numSamples > 0) { mCurrentVal = results[numSamples - 1]; }
+        }
+
+        float getResult(void) const override { return mCurrentVal; }
+
+        void clear(void) override {
+            for (size_t k = 0; k < Sections; ++k) {
+                mS1[k] = 0;
+                mS2[k] = 0;
+            }
+            mCurrentVal = 0;
+        }
+
+        size_t serialize(uint8_t * buffer, const size_t len) const override {
+            FilterStateWriter writer(buffer, len, FilterState::BIQUAD);
+            writer.put(mCurrentVal);
+            writer.putArray(mS1, Sections);
+            writer.putArray(mS2, Sections);
+            return writer.finish();
+        }
+
+        bool deserialize(const uint8_t * buffer, const size_t len) override {
+            FilterStateReader reader(buffer, len, FilterState::BIQUAD);
+            float currentVal = 0;
+            float s1[Sections];
+            float s2[Sections];
+            reader.get(currentVal);
+            reader.getArray(s1, Sections);
+            reader.getArray(s2, Sections);
+            if (!reader.isValid()) { return false; }
+            for (size_t k = 0; k < Sections; ++k) {
+                mS1[k] = s1[k];
+                mS2[k] = s2[k];
+            }
+            mCurrentVal = currentVal;
+            return true;
+        }
+
+    private:
+        /**
+         * Runs one sample through every section.
+         * 
+         * @param[in] x Input value.
+         * @return Output of the last section.
+         */
+        inline float step(float x) {
+            for (size_t k = 0; k < Sections; ++k) {
+                const BiquadCoefficients & c = mCoeffs.section[k];
+                /* Transposed direct form II. */
+                const float y = c.b0 * x + mS1[k];
+                mS1[k] = c.b1 * x - c.a1 * y + mS2[k];
+                mS2[k] = c.b2 * x - c.a2 * y;
+                x = y;
+            }
+            return x;
+        }
+
+    private:
+        /** Section coefficients. */
+        BiquadCascadeCoefficients<Sections> mCoeffs;
+
+        /** Delay state of each section. */
+        float mS1[Sections];
+        float mS2[Sections];
+};
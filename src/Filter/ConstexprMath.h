@@ -0,0 +1,87 @@
+/**
+ * Maximum Power Point Tracker Project
+ * 
+ * File: ConstexprMath.h
+ * Author: Matthew Yu
+ * Organization: UT Solar Vehicles Team
+ * Created on: October 17th, 2026
+ * Last Modified: 10/17/26
+ * 
+ * File Description: This header file implements the ConstexprMath class, a set
+ * of math functions that can be evaluated at compile time, so filter
+ * coefficients can be designed as constexpr tables. The <cmath> equivalents
+ * are not constexpr before C++26. Evaluated in double precision.
+ */
+#pragma once
+
+class ConstexprMath final {
+    public:
+        static constexpr double PI = 3.14159265358979323846;
+
+        /**
+         * Square root by Newton's method.
+         * 
+         * @param[in] x Input value.
+         * @return sqrt(x), or 0 for non-positive x.
+         */
+        static constexpr double sqrt(const double x) {
+            if (x <= 0) { return 0; }
+            double guess = (x > 1) ? x : 1;
+            for (int i = 0; i < 128; ++i) {
+                double next = 0.5 * (guess + x / guess);
+                if (next >= guess) { break; }
+                guess = next;
+            }
+            return guess;
+        }
+
+        /**
+         * Sine by Taylor series after reducing the input to [-pi, pi].
+         * 
+         * @param[in] x Angle in radians.
+         * @return sin(x).
+         */
+        static constexpr double sin(const double x) {
+            const double r = reduce(x);
+            double term = r;
+            double sum = r;
+            for (int n = 1; n < 30; ++n) {
+                term *= -r * r / ((2 * n) * (2 * n + 1));
+                sum += term;
+            }
+            return sum;
+        }
+
+        /**
+         * Cosine by Taylor series after reducing the input to [-pi, pi].
+         * 
+         * @param[in] x Angle in radians.
+         * @return cos(x).
+         */
+        static constexpr double cos(const double x) {
+            const double r = reduce(x);
+            double term = 1;
+            double sum = 1;
+            for (int n = 1; n < 30; ++n) {
+                term *= -r * r / ((2 * n - 1) * (2 * n));
+                sum += term;
+            }
+            return sum;
+        }
+
+        /**
+         * Tangent.
+         * 
+         * @param[in] x Angle in radians, away from odd multiples of pi / 2.
+         * @return tan(x).
+         */
+        static constexpr double tan(const double x) { return sin(x) / cos(x); }
+
+    private:
+        /** Reduces an angle into [-pi, pi]. */
+        static constexpr double reduce(const double x) {
+            double turns = x / (2 * PI);
+            long long whole = (long long) (turns + ((turns >= 0) ? 0.5 : -0.5));
+            return x - (double) whole * 2 * PI;
+        }
+};
@@ -0,0 +1,173 @@
+/**
+ * Maximum Power Point Tracker Project
+ * 
+ * File: DecimatingFilter.h
+ * Author: Matthew Yu
+ * Organization: UT Solar Vehicles Team
+ * Created on: October 17th, 2026
+ * Last Modified: 10/17/26
+ * 
+ * File Description: This header file implements the DecimatingFilter class,
+ * which is a derived class from the parent Filter class. It is a boxcar
+ * decimator (a first order CIC filter): it averages each block of R input
+ * samples and emits one output per block.
+ * 
+ * This lets a channel oversample at hardware rates, gaining resolution from the
+ * averaging, while the rest of the pipeline (further filters, consumers) only
+ * runs at the decimated rate. Callers check isOutputReady, or use decimate to
+ * push a burst and collect however many outputs it completed. Snapshots hold
+ * the partial block and the last output.
+ */
+#pragma once
+#include "Filter.h"
+#include "FilterState.h"
+
+class DecimatingFilter final : public Filter {
+    public:
+        /** Default constructor for a DecimatingFilter object. Ratio of 10. */
+        DecimatingFilter(void) : Filter(10) { init(); }
+
+        /**
+         * Constructor for a DecimatingFilter object.
+         * 
+         * @param[in] ratio Number of input samples averaged into each output.
+         * @precondition ratio is a positive number.
+         */
+        DecimatingFilter(const uint16_t ratio) : Filter(ratio) { init(); }
+
+        void addSample(const float sample) override {
+            mSum += sample;
+            if (++mCount == mMaxSamples) { emit(); }
+        }
+
+        void addSamples(const float * samples, const size_t numSamples) override {
+            consume(samples, numSamples, nullptr);
+        }
+
+        /**
+         * Pushes a burst of input samples and collects the outputs it
+         * completes.
+         * 
+         * @param[in] samples Pointer to the input values.
+         * @param[in] numSamples Number of input values.
+         * @param[out] outputs Pointer to an array with room for at least
+         *                     numSamples / ratio + 1 outputs.
+         * @return Number of outputs written.
+         */
+        size_t decimate(const float * samples, const size_t numSamples, float * outputs) {
+            return consume(samples, numSamples, outputs);
+        }
+
+        /** Returns the most recent decimated output. */
+        float getResult(void) const override { return mCurrentVal; }
+
+        /**
+         * Returns whether a decimated output was produced since the last call
+         * to readOutput.
+         */
+        bool isOutputReady(void) const { return mReady; }
+
+        /**
+         * Returns the most recent decimated output and lowers the ready flag.
+         * 
+         * @return Decimated output.
+         */
+        float readOutput(void) {
+            mReady = false;
+            return mCurrentVal;
+        }
+
+        /** Returns the decimation ratio. */
+        uint16_t getRatio(void) const { return mMaxSamples; }
+
+        void clear(void) override {
+            mSum = 0;
+            mCount = 0;
+            mReady = false;
+            mCurrentVal = 0;
+        }
+
+        size_t serialize(uint8_t * buffer, const size_t len) const override {
+            FilterStateWriter writer(buffer, len, FilterState::DECIMATING);
+            writer.put(mSum);
+            writer.put(mCount);
+            writer.put(mCurrentVal);
+            writer.put(mReady);
+            return writer.finish();
+        }
+
+        bool deserialize(const uint8_t * buffer, const size_t len) override {
+            FilterStateReader reader(buffer, len, FilterState::DECIMATING);
+            float sum = 0;
+            uint16_t count = 0;
+            float currentVal = 0;
+            bool ready = false;
+            reader.get(sum);
+            reader.get(count);
+            reader.get(currentVal);
+            reader.get(ready);
+            /* A partial block from a larger ratio would never close. */
+            if (!reader.isValid() || count >= mMaxSamples) { return false; }
+            mSum = sum;
+            mCount = count;
+            mCurrentVal = currentVal;
+            mReady = ready;
+            return true;
+        }
+
+    private:
+        void init(void) {
+            mScale = 1.0f / mMaxSamples;
+            clear();
+        }
+
+        /**
+         * Accumulates samples block by block, summing up to each block
+         * boundary without per sample checks.
+         * 
+         * @param[in] samples Pointer to the input values.
+         * @param[in] numSamples Number of input values.
+         * @param[out] outputs Where completed outputs are written. May be null.
+         * @return Number of outputs completed.
+         */
+        size_t consume(const float * samples, const size_t numSamples, float * outputs) {
+            size_t numOutputs = 0;
+            size_t i = 0;
+            while (i < numSamples) {
+                size_t run = mMaxSamples - mCount;
+                if (run > numSamples - i) { run = numSamples - i; }
+                float sum = mSum;
+                for (size_t j = 0; j < run; ++j) { sum += samples[i + j]; }
+                mSum = sum;
+                mCount += run;
+                i += run;
+                if (mCount == mMaxSamples) {
+                    emit();
+                    if (outputs != nullptr) { outputs[numOutputs] = mCurrentVal; }
+                    ++numOutputs;
+                }
+            }
+            return numOutputs;
+        }
+
+        /** Closes the current block. */
+        inline void emit(void) {
+            mCurrentVal = mSum * mScale;
+            mSum = 0;
+            mCount = 0;
+            mReady = true;
+        }
+
+    private:
+        /** Sum of the current block. */
+        float mSum;
+
+        /** Reciprocal of the ratio. */
+        float mScale;
+
+        /** Number of samples in the current block. */
+        uint16_t mCount;
+
+        /** Whether an output was produced and not yet read. */
+        bool mReady;
+};
@@ -5,7 +5,7 @@
  * Author: Matthew Yu
  * Organization: UT Solar Vehicles Team
  * Created on: September 20th, 2020
- * Last Modified: 06/08/21
+ * Last Modified: 10/17/26
  * 
  * File Description: This header file implements the EmaFilter class, which
  * is a derived class from the parent Filter class. EMA stands for Exponential
@@ -18,7 +18,7 @@
  */
 #pragma once
 #include "Filter.h"
-#include <stdio.h>
+#include "FilterState.h"
 
 class EmaFilter final : public Filter {
     public:
@@ -46,10 +46,49 @@ class EmaFilter final : public Filter {
             mAvg = (1-mAlpha) * mAvg + mAlpha * sample;
         }
 
+        void addSamples(const float * samples, const size_t numSamples) override {
+            /* Keep the state in locals so it stays in registers. */
+            float avg = mAvg;
+            const float alpha = mAlpha;
+            for (size_t i = 0; i < numSamples; ++i) {
+                avg = (1-alpha) * avg + alpha * samples[i];
+            }
+            mAvg = avg;
+        }
+
+        void filterSamples(
+            const float * samples,
+            float * results,
+            const size_t numSamples
+        ) override {
+            float avg = mAvg;
+            const float alpha = mAlpha;
+            for (size_t i = 0; i < numSamples; ++i) {
+                avg = (1-alpha) * avg + alpha * samples[i];
+                results[i] = avg;
+            }
+            mAvg = avg;
+        }
+
         float getResult(void) const override { return mAvg; }
 
         void clear(void) override { mAvg = 0; }
 
+        size_t serialize(uint8_t * buffer, const size_t len) const override {
+            FilterStateWriter writer(buffer, len, FilterState::EMA);
+            writer.put(mAvg);
+            return writer.finish();
+        }
+
+        bool deserialize(const uint8_t * buffer, const size_t len) override {
+            FilterStateReader reader(buffer, len, FilterState::EMA);
+            float avg = 0;
+            reader.get(avg);
+            if (!reader.isValid()) { return false; }
+            mAvg = avg;
+            return true;
+        }
+
     private:
         /** Weighted average of the data points. */
         float mAvg;
@@ -57,19 +96,3 @@ class EmaFilter final : public Filter {
         /** Alpha constant for weight depreciation. */
         float mAlpha;
 };
-
-void TEST() {
-    printf("Hello World Test\n");
-    // setup
-    EmaFilter filter(5, .2); // 5 sample buffer
-    // add 20 samples, increasing linearly by 10, and then some noisy 100s every 5 cycles.
-    for (uint16_t i = 0; i < 20; i++) {
-        if (i%5 == 0) { filter.addSample(100); } 
-        else { filter.addSample(i*10.0); }
-    
-        // read the filter output at every point
-        printf("output:\t%f\n\n", filter.getResult());
-    }
-    // shutdown
-    filter.shutdown();
-}
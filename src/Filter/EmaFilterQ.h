@@ -0,0 +1,77 @@
+/**
+ * Maximum Power Point Tracker Project
+ * 
+ * File: EmaFilterQ.h
+ * Author: Matthew Yu
+ * Organization: UT Solar Vehicles Team
+ * Created on: October 17th, 2026
+ * Last Modified: 10/17/26
+ * 
+ * File Description: This header file implements the EmaFilterQ class, a fixed
+ * point, saturating Exponential Moving Average over raw integer sample codes.
+ * It mirrors EmaFilter but never touches floating point after construction.
+ * See FixedPoint.h.
+ */
+#pragma once
+#include "FixedPoint.h"
+#include <stddef.h>
+
+/**
+ * @tparam Q Q15 or Q31. Selects the sample and coefficient widths.
+ */
+template <typename Q>
+class EmaFilterQ final {
+    public:
+        typedef typename Q::Sample Sample;
+
+    public:
+        /**
+         * Constructor for a EmaFilterQ object.
+         * 
+         * @param[in] alpha A constant from [0, 1] inclusive that indicates the
+         *                  weight decline of each progressive sample. Stored
+         *                  as a Q fraction, so 1.0 saturates just below 1.
+         */
+        constexpr EmaFilterQ(const float alpha) :
+            mAvg(0), mAlpha(toQ<Q>(alpha)) {}
+
+        /**
+         * Adds a sample to the filter and updates calculations.
+         * 
+         * @param[in] sample Raw sample code.
+         */
+        void addSample(const Sample sample) {
+            mAvg = blendQ<Q>(mAvg, sample, mAlpha);
+        }
+
+        /**
+         * Adds a block of samples to the filter in order.
+         * 
+         * @param[in] samples Pointer to the raw sample codes.
+         * @param[in] numSamples Number of samples.
+         */
+        void addSamples(const Sample * samples, const size_t numSamples) {
+            typename Q::State avg = mAvg;
+            for (size_t i = 0; i < numSamples; ++i) {
+                avg = blendQ<Q>(avg, samples[i], mAlpha);
+            }
+            mAvg = avg;
+        }
+
+        /**
+         * Returns the filtered result of the input data.
+         * 
+         * @return Weighted average, rounded to the nearest code.
+         */
+        Sample getResult(void) const { return stateToSample<Q>(mAvg); }
+
+        /** Clears data stored in the filter. */
+        void clear(void) { mAvg = 0; }
+
+    private:
+        /** Weighted average of the data points, with extra fraction bits. */
+        typename Q::State mAvg;
+
+        /** Alpha constant for weight depreciation, as a Q fraction. */
+        Sample mAlpha;
+};
@@ -5,27 +5,38 @@
  * Author: Matthew Yu
  * Organization: UT Solar Vehicles Team
  * Created on: September 19th, 2020
- * Last Modified: 06/06/21
+ * Last Modified: 10/17/26
  * 
  * File Description: This implementation file describes the Filter class, which
  * is an inherited class that allows callers to filter and denoise input data.
  */
 #include "Filter.h"
 
-Filter::Filter(void) {
-    mMaxSamples = 10;
-    mCurrentVal = 0;
-}
+void Filter::addSample(const float val) { mCurrentVal = val; }
 
-Filter::Filter(const uint16_t maxSamples) {
-    mMaxSamples = maxSamples;
-    mCurrentVal = 0;
+void Filter::addSamples(const float * samples, const size_t numSamples) {
+    for (size_t i = 0; i < numSamples; ++i) {
+        addSample(samples[i]);
+    }
 }
 
-void Filter::addSample(const float val) { mCurrentVal = val; }
+void Filter::filterSamples(
+    const float * samples,
+    float * results,
+    const size_t numSamples
+) {
+    for (size_t i = 0; i < numSamples; ++i) {
+        addSample(samples[i]);
+        results[i] = getResult();
+    }
+}
 
 float Filter::getResult(void) const { return mCurrentVal; }
 
 void Filter::clear(void) { mCurrentVal = 0; }
 
 void Filter::shutdown(void) { return; }
+
+size_t Filter::serialize(uint8_t *, const size_t) const { return 0; }
+
+bool Filter::deserialize(const uint8_t *, const size_t) { return false; }
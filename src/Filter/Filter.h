@@ -5,7 +5,7 @@
  * Author: Matthew Yu
  * Organization: UT Solar Vehicles Team
  * Created on: September 19th, 2020
- * Last Modified: 06/06/21
+ * Last Modified: 10/17/26
  * 
  * File Description: This header file describes the Filter class, which is an
  * inherited class that allows callers to filter and denoise input data.
@@ -13,19 +13,23 @@
  */
 #pragma once
 #include <stdint.h>
+#include <stddef.h>
 
 class Filter {
     public:
         /** Default constructor for a filter object. 10 sample size. */
-        Filter(void);
+        constexpr Filter(void) : mMaxSamples(10), mCurrentVal(0) {}
 
         /**
          * constructor for a filter object.
          * 
          * @param[in] maxSamples Number of samples that the filter should hold
          *                       at maximum at any one time.
+         * @note Constructors are constexpr so that derived filters with fixed
+         *       storage can be constant initialized in static memory.
          */
-        Filter(const uint16_t maxSamples);
+        constexpr Filter(const uint16_t maxSamples) :
+            mMaxSamples(maxSamples), mCurrentVal(0) {}
 
         /**
          * Adds a sample to the filter and updates calculations.
@@ -35,7 +39,34 @@ class Filter {
         virtual void addSample(const float val);
 
         /**
-         * Returns the filtered result of the input data.
+         * Adds a block of samples to the filter in order and updates
+         * calculations. Equivalent to calling addSample on each sample, but
+         * derived classes may override it with a tighter loop.
+         * 
+         * @param[in] samples Pointer to the input values.
+         * @param[in] numSamples Number of input values.
+         */
+        virtual void addSamples(const float * samples, const size_t numSamples);
+
+        /**
+         * Adds a block of samples to the filter in order and writes the
+         * filtered result after each sample into the output array.
+         * 
+         * @param[in] samples Pointer to the input values.
+         * @param[out] results Pointer to an array of at least numSamples
+         *                     values to fill. May alias samples.
+         * @param[in] numSamples Number of input values.
+         */
+        virtual void filterSamples(
+            const float * samples,
+            float * results,
+            const size_t numSamples
+        );
+
+        /**
+         * Returns the filtered result of the input data. Filters with an
+         * expensive output may defer computing it until this call, so that
+         * adding samples stays cheap.
          * 
          * @return Filter output.
          */
@@ -47,10 +78,42 @@ class Filter {
         /** Deallocates constructs in the filter for shutdown. */
         virtual void shutdown(void);
 
+        /**
+         * Writes a snapshot of the filter state, i.e. to backup RAM or flash,
+         * so it can be restored after a reset. See FilterState.h for the
+         * format. Configuration set at construction is not included.
+         * 
+         * Every derived filter with state must override this and
+         * deserialize with a format of its own. The base implementation
+         * writes nothing, so a filter without one (including the passthrough,
+         * whose output is simply its next input) is never reported as saved.
+         * 
+         * @param[out] buffer Destination. Pass null to query the snapshot size.
+         * @param[in] len Size of the buffer in bytes.
+         * @return Size of the snapshot in bytes, or 0 if the buffer is too
+         *         small or the filter has no snapshot format.
+         */
+        virtual size_t serialize(uint8_t * buffer, const size_t len) const;
+
+        /**
+         * Restores a snapshot written by serialize from the same type of
+         * filter.
+         * 
+         * @param[in] buffer Snapshot.
+         * @param[in] len Size of the buffer in bytes.
+         * @return Whether the snapshot was restored. A rejected snapshot (wrong
+         *         filter type, version or size) leaves the filter unchanged.
+         *         The base implementation rejects every snapshot.
+         */
+        virtual bool deserialize(const uint8_t * buffer, const size_t len);
+
     protected:
         /** Maximum number of samples that can be held. */
         uint16_t mMaxSamples;
 
-        /** Current value of the filter output. */
-        float mCurrentVal;
+        /**
+         * Current value of the filter output. Mutable so that lazily
+         * evaluated filters can cache it from getResult.
+         */
+        mutable float mCurrentVal;
 };
@@ -0,0 +1,319 @@
+/**
+ * Maximum Power Point Tracker Project
+ * 
+ * File: FilterBank.h
+ * Author: Matthew Yu
+ * Organization: UT Solar Vehicles Team
+ * Created on: October 17th, 2026
+ * Last Modified: 10/17/26
+ * 
+ * File Description: This header file implements the SmaFilterBank,
+ * EmaFilterBank and KalmanFilterBank classes, which run the same filter over
+ * many channels at once (i.e. all string voltages of an array, or thousands of
+ * replayed channels on a host).
+ * 
+ * Each bank keeps its per channel state in structure-of-arrays layout, so one
+ * tick of samples for every channel is a single call over contiguous arrays.
+ * The inner loops are branch free and independent per channel, so the compiler
+ * can vectorize them (NEON, SSE/AVX2) without intrinsics.
+ * 
+ * Storage is in-object; large banks should live in static memory or on the
+ * heap rather than on a thread stack.
+ */
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <array>
+
+/** Alignment of the per channel state, wide enough for AVX2. */
+#define FILTER_BANK_ALIGN 32
+
+/**
+ * Simple Moving Average over many channels.
+ * 
+ * @tparam Channels Number of channels.
+ * @tparam N Number of samples per channel that the filter should hold at
+ *           maximum at any one time.
+ */
+template <size_t Channels, uint16_t N>
+class SmaFilterBank final {
+    static_assert(Channels > 0 && N > 0, "SmaFilterBank requires positive sizes.");
+
+    public:
+        /** Constructor for a SmaFilterBank object. */
+        SmaFilterBank(void) : mSum{}, mDataBuffer{} { clear(); }
+
+        /**
+         * Adds one sample to every channel.
+         * 
+         * @param[in] samples Pointer to Channels contiguous samples, one per
+         *                    channel.
+         */
+        void addSamples(const float * __restrict__ samples) {
+            float * __restrict__ sum = mSum.data();
+            float * __restrict__ ring = mDataBuffer.data() + (size_t) mIdx * Channels;
+
+            if (mNumSamples < N) {
+                ++mNumSamples;
+                for (size_t c = 0; c < Channels; ++c) {
+                    sum[c] += samples[c];
+                    ring[c] = samples[c];
+                }
+            } else {
+                /* Add the new value but remove the value at the current index
+                   we're overwriting. */
+                for (size_t c = 0; c < Channels; ++c) {
+                    sum[c] += samples[c] - ring[c];
+                    ring[c] = samples[c];
+                }
+            }
+            if (++mIdx == N) { mIdx = 0; }
+        }
+
+        /**
+         * Adds several ticks of samples to every channel.
+         * 
+         * @param[in] samples Pointer to numTicks * Channels samples, tick
+         *                    major (all channels of tick 0, then tick 1, ...).
+         * @param[in] numTicks Number of ticks.
+         */
+        void addBlock(const float * samples, const size_t numTicks) {
+            for (size_t t = 0; t < numTicks; ++t) {
+                addSamples(samples + t * Channels);
+            }
+        }
+
+        /**
+         * Returns the filtered result of a channel.
+         * 
+         * @param[in] channel Channel index.
+         * @return Filter output.
+         */
+        float getResult(const size_t channel) const {
+            if (mNumSamples == 0) { return 0.0; }
+            return mSum[channel] / mNumSamples;
+        }
+
+        /**
+         * Writes the filtered result of every channel.
+         * 
+         * @param[out] results Pointer to an array of Channels values to fill.
+         */
+        void getResults(float * __restrict__ results) const {
+            const float scale = (mNumSamples == 0) ? 0.0 : 1.0f / mNumSamples;
+            const float * __restrict__ sum = mSum.data();
+            for (size_t c = 0; c < Channels; ++c) {
+                results[c] = sum[c] * scale;
+            }
+        }
+
+        /** Clears data stored in every channel. */
+        void clear(void) {
+            mSum.fill(0);
+            mNumSamples = 0;
+            mIdx = 0;
+        }
+
+    private:
+        /** Sum of the current window of each channel. */
+        alignas(FILTER_BANK_ALIGN) std::array<float, Channels> mSum;
+
+        /** Data Buffer, N ticks of Channels samples. */
+        alignas(FILTER_BANK_ALIGN) std::array<float, Channels * N> mDataBuffer;
+
+        /** Number of samples in the buffer, shared by all channels. */
+        uint16_t mNumSamples;
+
+        /** Current tick index in the buffer. */
+        uint16_t mIdx;
+};
+
+/**
+ * Exponential Moving Average over many channels.
+ * 
+ * @tparam Channels Number of channels.
+ */
+template <size_t Channels>
+class EmaFilterBank final {
+    static_assert(Channels > 0, "EmaFilterBank requires a positive channel count.");
+
+    public:
+        /**
+         * Constructor for a EmaFilterBank object.
+         * 
+         * @param[in] alpha A constant from [0, 1] inclusive that indicates the
+         *                  weight decline of each progressive sample. Applied
+         *                  to every channel.
+         */
+        EmaFilterBank(const float alpha) : mAvg{}, mAlpha{} {
+            mAlpha.fill(alpha);
+        }
+
+        /**
+         * Sets the alpha constant of a single channel.
+         * 
+         * @param[in] channel Channel index.
+         * @param[in] alpha A constant from [0, 1] inclusive.
+         */
+        void setAlpha(const size_t channel, const float alpha) { mAlpha[channel] = alpha; }
+
+        /**
+         * Adds one sample to every channel.
+         * 
+         * @param[in] samples Pointer to Channels contiguous samples, one per
+         *                    channel.
+         */
+        void addSamples(const float * __restrict__ samples) {
+            float * __restrict__ avg = mAvg.data();
+            const float * __restrict__ alpha = mAlpha.data();
+            for (size_t c = 0; c < Channels; ++c) {
+                avg[c] = (1-alpha[c]) * avg[c] + alpha[c] * samples[c];
+            }
+        }
+
+        /**
+         * Adds several ticks of samples to every channel.
+         * 
+         * @param[in] samples Pointer to numTicks * Channels samples, tick
+         *                    major.
+         * @param[in] numTicks Number of ticks.
+         */
+        void addBlock(const float * samples, const size_t numTicks) {
+            for (size_t t = 0; t < numTicks; ++t) {
+                addSamples(samples + t * Channels);
+            }
+        }
+
+        float getResult(const size_t channel) const { return mAvg[channel]; }
+
+        void getResults(float * results) const {
+            for (size_t c = 0; c < Channels; ++c) { results[c] = mAvg[c]; }
+        }
+
+        void clear(void) { mAvg.fill(0); }
+
+    private:
+        /** Weighted average of each channel. */
+        alignas(FILTER_BANK_ALIGN) std::array<float, Channels> mAvg;
+
+        /** Alpha constant of each channel. */
+        alignas(FILTER_BANK_ALIGN) std::array<float, Channels> mAlpha;
+};
+
+/**
+ * Scalar Kalman filter over many channels. Matches KalmanFilter in its
+ * DYNAMIC gain mode.
+ * 
+ * @tparam Channels Number of channels.
+ */
+template <size_t Channels>
+class KalmanFilterBank final {
+    static_assert(Channels > 0, "KalmanFilterBank requires a positive channel count.");
+
+    public:
+        /** Default constructor for a KalmanFilterBank object. Uses the
+            KalmanFilter defaults on every channel. */
+        KalmanFilterBank(void) : KalmanFilterBank(10.0, 225, 25, 0.15) {}
+
+        /**
+         * Constructor for a KalmanFilterBank object. See KalmanFilter for the
+         * meaning of each parameter; they are applied to every channel.
+         * 
+         * @param[in] initialEstimate Initial guess of a sensor sample value.
+         * @param[in] estimateUncertainty Estimate uncertainty variance.
+         * @param[in] measurementUncertainty Uncertainty of the input measurement.
+         * @param[in] processNoiseVariance Measurement of how good we think our
+         *                       model is.
+         */
+        KalmanFilterBank(
+            const float initialEstimate,
+            const float estimateUncertainty,
+            const float measurementUncertainty,
+            const float processNoiseVariance
+        ) : mEstimate{}, mEu{}, mMu{}, mQ{} {
+            mInitEstimate = initialEstimate;
+            mInitEu = estimateUncertainty;
+            mMu.fill(measurementUncertainty);
+            mQ.fill(processNoiseVariance);
+            clear();
+        }
+
+        /**
+         * Sets the noise model of a single channel.
+         * 
+         * @param[in] channel Channel index.
+         * @param[in] measurementUncertainty Uncertainty of the input measurement.
+         * @param[in] processNoiseVariance Process noise variance.
+         */
+        void setNoise(
+            const size_t channel,
+            const float measurementUncertainty,
+            const float processNoiseVariance
+        ) {
+            mMu[channel] = measurementUncertainty;
+            mQ[channel] = processNoiseVariance;
+        }
+
+        /**
+         * Adds one sample to every channel.
+         * 
+         * @param[in] samples Pointer to Channels contiguous samples, one per
+         *                    channel.
+         */
+        void addSamples(const float * __restrict__ samples) {
+            float * __restrict__ estimate = mEstimate.data();
+            float * __restrict__ eu = mEu.data();
+            const float * __restrict__ mu = mMu.data();
+            const float * __restrict__ q = mQ.data();
+            for (size_t c = 0; c < Channels; ++c) {
+                /* Kalman Gain. */
+                float K = eu[c] / (eu[c] + mu[c]);
+                /* Estimate update (state update). */
+                estimate[c] = estimate[c] + K * (samples[c] - estimate[c]);
+                /* Estimate uncertainty, then predict estimate uncertainty. */
+                eu[c] = (1-K) * eu[c] + q[c];
+            }
+        }
+
+        /**
+         * Adds several ticks of samples to every channel.
+         * 
+         * @param[in] samples Pointer to numTicks * Channels samples, tick
+         *                    major.
+         * @param[in] numTicks Number of ticks.
+         */
+        void addBlock(const float * samples, const size_t numTicks) {
+            for (size_t t = 0; t < numTicks; ++t) {
+                addSamples(samples + t * Channels);
+            }
+        }
+
+        float getResult(const size_t channel) const { return mEstimate[channel]; }
+
+        void getResults(float * results) const {
+            for (size_t c = 0; c < Channels; ++c) { results[c] = mEstimate[c]; }
+        }
+
+        /** Resets every channel's estimate and uncertainty. */
+        void clear(void) {
+            mEstimate.fill(mInitEstimate);
+            mEu.fill(mInitEu);
+        }
+
+    private:
+        /** Guess of each channel. */
+        alignas(FILTER_BANK_ALIGN) std::array<float, Channels> mEstimate;
+
+        /** Estimate uncertainty (variance) of each channel. */
+        alignas(FILTER_BANK_ALIGN) std::array<float, Channels> mEu;
+
+        /** Measurement uncertainty of each channel. */
+        alignas(FILTER_BANK_ALIGN) std::array<float, Channels> mMu;
+
+        /** Process noise variance of each channel. */
+        alignas(FILTER_BANK_ALIGN) std::array<float, Channels> mQ;
+
+        /** Initial values, restored on clear. */
+        float mInitEstimate;
+        float mInitEu;
+};
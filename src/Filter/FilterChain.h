@@ -0,0 +1,209 @@
+/**
+ * Maximum Power Point Tracker Project
+ * 
+ * File: FilterChain.h
+ * Author: Matthew Yu
+ * Organization: UT Solar Vehicles Team
+ * Created on: October 17th, 2026
+ * Last Modified: 10/17/26
+ * 
+ * File Description: This header file implements the FilterChain class, which
+ * is a derived class from the parent Filter class. A FilterChain runs a fixed
+ * pipeline of filters, feeding each stage's output into the next stage in a
+ * single addSample call (i.e. a MedianFilterN to despike followed by an
+ * EmaFilter to smooth).
+ * 
+ * Stages are stored by value and called by their concrete type, so only the
+ * call into the chain itself goes through the Filter vtable; the stages are
+ * resolved at compile time and can be inlined.
+ * 
+ * A chain snapshot holds the snapshot of each stage, in order.
+ */
+#pragma once
+#include "Filter.h"
+#include "FilterState.h"
+
+/** Recursive storage for the stages of a FilterChain. */
+template <typename... Stages>
+class FilterStages;
+
+/** End of the chain. Passes its input through. */
+template <>
+class FilterStages<> {
+    public:
+        constexpr FilterStages(void) {}
+        float push(const float val) { return val; }
+        void clear(void) {}
+        void shutdown(void) {}
+        void serialize(FilterStateWriter &) const {}
+        void deserialize(FilterStateReader &) {}
+};
+
+template <typename First, typename... Rest>
+class FilterStages<First, Rest...> {
+    public:
+        constexpr FilterStages(void) : mFirst(), mRest() {}
+        constexpr FilterStages(const First & first, const Rest &... rest) :
+            mFirst(first), mRest(rest...) {}
+
+        /**
+         * Feeds a value into this stage and the result down the rest of the
+         * chain.
+         * 
+         * @param[in] val Input value.
+         * @return Output of the last stage.
+         */
+        float push(const float val) {
+            mFirst.First::addSample(val);
+            return mRest.push(mFirst.First::getResult());
+        }
+
+        void clear(void) {
+            mFirst.First::clear();
+            mRest.clear();
+        }
+
+        void shutdown(void) {
+            mFirst.First::shutdown();
+            mRest.shutdown();
+        }
+
+        /** Appends the snapshot of each stage to a chain snapshot. */
+        void serialize(FilterStateWriter & writer) const {
+            writer.advance(mFirst.First::serialize(writer.cursor(), writer.remaining()));
+            mRest.serialize(writer);
+        }
+
+        /**
+         * Restores each stage from a chain snapshot. Stops at the first stage
+         * that rejects its snapshot.
+         */
+        void deserialize(FilterStateReader & reader) {
+            const size_t size = FilterState::size(reader.cursor(), reader.remaining());
+            if (size == 0 || !mFirst.First::deserialize(reader.cursor(), size)) {
+                reader.advance(0);
+                return;
+            }
+            reader.advance(size);
+            mRest.deserialize(reader);
+        }
+
+        First & first(void) { return mFirst; }
+        FilterStages<Rest...> & rest(void) { return mRest; }
+
+    private:
+        First mFirst;
+        FilterStages<Rest...> mRest;
+};
+
+/** Looks up the Ith stage of a FilterStages list. */
+template <size_t I, typename... Stages>
+struct FilterStageAt;
+
+template <typename First, typename... Rest>
+struct FilterStageAt<0, First, Rest...> {
+    typedef First Type;
+    static First & get(FilterStages<First, Rest...> & stages) { return stages.first(); }
+};
+
+template <size_t I, typename First, typename... Rest>
+struct FilterStageAt<I, First, Rest...> {
+    typedef typename FilterStageAt<I - 1, Rest...>::Type Type;
+    static Type & get(FilterStages<First, Rest...> & stages) {
+        return FilterStageAt<I - 1, Rest...>::get(stages.rest());
+    }
+};
+
+/**
+ * @tparam Stages Filter types, in the order samples flow through them. Each
+ *                stage must provide addSample, getResult, clear, shutdown,
+ *                serialize and deserialize, as every Filter does. The
+ *                chain only writes a snapshot if every stage does.
+ */
+template <typename... Stages>
+class FilterChain final : public Filter {
+    public:
+        /** Default constructor for a FilterChain object. Default constructs
+            each stage. */
+        constexpr FilterChain(void) : Filter(), mStages() {}
+
+        /**
+         * Constructor for a FilterChain object.
+         * 
+         * @param[in] stages Configured filters to copy into the chain, in the
+         *                   order samples flow through them. The chain takes
+         *                   over any heap storage owned by the stages.
+         */
+        constexpr FilterChain(const Stages &... stages) :
+            Filter(), mStages(stages...) {}
+
+        void addSample(const float sample) override {
+            mCurrentVal = mStages.push(sample);
+        }
+
+        void addSamples(const float * samples, const size_t numSamples) override {
+            float val = mCurrentVal;
+            for (size_t i = 0; i < numSamples; ++i) {
+                val = mStages.push(samples[i]);
+            }
+            mCurrentVal = val;
+        }
+
+        void filterSamples(
+            const float * samples,
+            float * results,
+            const size_t numSamples
+        ) override {
+            for (size_t i = 0; i < numSamples; ++i) {
+                results[i] = mStages.push(samples[i]);
+            }
+            if (numSamples > 0) { mCurrentVal = results[numSamples - 1]; }
+        }
+
+        float getResult(void) const override { return mCurrentVal; }
+
+        void clear(void) override {
+            mStages.clear();
+            mCurrentVal = 0;
+        }
+
+        void shutdown(void) override { mStages.shutdown(); }
+
+        size_t serialize(uint8_t * buffer, const size_t len) const override {
+            FilterStateWriter writer(buffer, len, FilterState::CHAIN);
+            writer.put(mCurrentVal);
+            mStages.serialize(writer);
+            return writer.finish();
+        }
+
+        /**
+         * Restores the chain and each of its stages.
+         * 
+         * @note Stages are restored in order; if a later stage rejects its
+         *       snapshot, earlier stages have already been restored.
+         */
+        bool deserialize(const uint8_t * buffer, const size_t len) override {
+            FilterStateReader reader(buffer, len, FilterState::CHAIN);
+            float currentVal = 0;
+            reader.get(currentVal);
+            if (!reader.isOk()) { return false; }
+            mStages.deserialize(reader);
+            if (!reader.isValid()) { return false; }
+            mCurrentVal = currentVal;
+            return true;
+        }
+
+        /**
+         * Returns a stage of the chain, i.e. to tune or inspect it.
+         * 
+         * @tparam I Index of the stage, starting at 0.
+         * @return Reference to the stage.
+         */
+        template <size_t I>
+        typename FilterStageAt<I, Stages...>::Type & getStage(void) {
+            return FilterStageAt<I, Stages...>::get(mStages);
+        }
+
+    private:
+        FilterStages<Stages...> mStages;
+};
@@ -0,0 +1,255 @@
+/**
+ * Maximum Power Point Tracker Project
+ * 
+ * File: FilterState.h
+ * Author: Matthew Yu
+ * Organization: UT Solar Vehicles Team
+ * Created on: October 17th, 2026
+ * Last Modified: 10/17/26
+ * 
+ * File Description: This header file describes the binary snapshot format used
+ * by Filter::serialize and Filter::deserialize, and the FilterStateWriter and
+ * FilterStateReader classes that produce and parse it. Snapshots let filter
+ * state be stashed in backup RAM or flash and restored after a reset, so
+ * filters do not start converging from scratch.
+ * 
+ * A snapshot is a 4 byte header followed by a payload:
+ * 
+ *     [tag: u8][version: u8][payload length: u16][payload]
+ * 
+ * The tag names the filter type, so a snapshot is never restored into the
+ * wrong kind of filter. Templated filters (i.e. FirFilter<N>) also check the
+ * payload length, so a snapshot is never restored into a different size.
+ * Values are stored in native byte order; snapshots are meant to be restored
+ * by the same firmware on the same part.
+ */
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+/** Snapshot format version. Bump when any payload layout changes. */
+#define FILTER_STATE_VERSION 2
+
+/** Size of the snapshot header in bytes. */
+#define FILTER_STATE_HEADER_SIZE 4
+
+struct FilterState {
+    /** Filter type stored in a snapshot header. */
+    enum Tag {
+        SMA = 1,
+        EMA,
+        MEDIAN,
+        KALMAN,
+        CHAIN,
+        KALMAN_N,
+        BIQUAD,
+        FIR,
+        DECIMATING,
+        SLIDING_EXTREMA,
+        VARIANCE,
+        EMA_VARIANCE,
+        ALPHA_BETA,
+        QUANTILE,
+        SAVITZKY_GOLAY,
+        GOERTZEL,
+        AGGREGATING
+    };
+
+    /**
+     * Returns the total size of the snapshot at the start of a buffer, read
+     * from its header.
+     * 
+     * @param[in] buffer Snapshot.
+     * @param[in] len Size of the buffer in bytes.
+     * @return Size of the snapshot in bytes, or 0 if the buffer does not hold
+     *         a full snapshot.
+     */
+    static size_t size(const uint8_t * buffer, const size_t len) {
+        if (buffer == nullptr || len < FILTER_STATE_HEADER_SIZE) { return 0; }
+        uint16_t payload;
+        memcpy(&payload, buffer + 2, sizeof(payload));
+        const size_t total = FILTER_STATE_HEADER_SIZE + payload;
+        return (total <= len) ? total : 0;
+    }
+};
+
+/**
+ * Writes a snapshot. With a null buffer, nothing is written and finish returns
+ * the size the snapshot would need.
+ */
+class FilterStateWriter {
+    public:
+        /**
+         * Constructor for a FilterStateWriter object.
+         * 
+         * @param[out] buffer Destination, or null to measure.
+         * @param[in] len Size of the buffer in bytes.
+         * @param[in] tag Filter type to store in the header.
+         */
+        FilterStateWriter(uint8_t * buffer, const size_t len, const FilterState::Tag tag) :
+            mBuffer(buffer), mLen(len), mPos(FILTER_STATE_HEADER_SIZE), mOk(true) {
+            if (mBuffer == nullptr) { return; }
+            if (mLen < FILTER_STATE_HEADER_SIZE) {
+                mOk = false;
+                return;
+            }
+            mBuffer[0] = (uint8_t) tag;
+            mBuffer[1] = FILTER_STATE_VERSION;
+        }
+
+        /**
+         * Appends a trivially copyable value.
+         * 
+         * @param[in] val Value to write.
+         */
+        template <typename T>
+        void put(const T & val) { putBytes(&val, sizeof(T)); }
+
+        /**
+         * Appends an array of values.
+         * 
+         * @param[in] vals Values to write.
+         * @param[in] count Number of values.
+         */
+        template <typename T>
+        void putArray(const T * vals, const size_t count) {
+            putBytes(vals, count * sizeof(T));
+        }
+
+        /** Returns where the next value would be written, or null. */
+        uint8_t * cursor(void) const {
+            return (mBuffer == nullptr || !mOk) ? nullptr : mBuffer + mPos;
+        }
+
+        /** Returns the number of bytes left in the buffer. */
+        size_t remaining(void) const { return (mPos <= mLen) ? mLen - mPos : 0; }
+
+        /**
+         * Skips over bytes written directly through cursor, i.e. a nested
+         * snapshot.
+         * 
+         * @param[in] count Number of bytes written. 0 marks a failed write.
+         */
+        void advance(const size_t count) {
+            if (count == 0) { mOk = false; }
+            mPos += count;
+        }
+
+        /**
+         * Completes the header.
+         * 
+         * @return Total size of the snapshot in bytes, or 0 if it did not fit.
+         */
+        size_t finish(void) {
+            const size_t payload = mPos - FILTER_STATE_HEADER_SIZE;
+            if (!mOk || payload > UINT16_MAX) { return 0; }
+            if (mBuffer != nullptr) {
+                const uint16_t len = (uint16_t) payload;
+                memcpy(mBuffer + 2, &len, sizeof(len));
+            }
+            return mPos;
+        }
+
+    private:
+        void putBytes(const void * src, const size_t count) {
+            if (mBuffer != nullptr) {
+                if (!mOk || count > remaining()) {
+                    mOk = false;
+                    return;
+                }
+                memcpy(mBuffer + mPos, src, count);
+            }
+            mPos += count;
+        }
+
+    private:
+        uint8_t * mBuffer;
+        size_t mLen;
+        size_t mPos;
+        bool mOk;
+};
+
+/**
+ * Reads a snapshot. The header is checked on construction; callers read the
+ * payload into locals and only commit them once isValid holds after the last
+ * read, so a rejected snapshot leaves the filter unchanged.
+ */
+class FilterStateReader {
+    public:
+        /**
+         * Constructor for a FilterStateReader object.
+         * 
+         * @param[in] buffer Snapshot.
+         * @param[in] len Size of the buffer in bytes.
+         * @param[in] tag Filter type the snapshot must hold.
+         */
+        FilterStateReader(const uint8_t * buffer, const size_t len, const FilterState::Tag tag) :
+            mBuffer(buffer), mEnd(FilterState::size(buffer, len)),
+            mPos(FILTER_STATE_HEADER_SIZE), mOk(mEnd != 0) {
+            if (mOk && (mBuffer[0] != (uint8_t) tag || mBuffer[1] != FILTER_STATE_VERSION)) {
+                mOk = false;
+            }
+        }
+
+        /**
+         * Reads a trivially copyable value.
+         * 
+         * @param[out] val Value read. Untouched on failure.
+         */
+        template <typename T>
+        void get(T & val) { getBytes(&val, sizeof(T)); }
+
+        /**
+         * Reads an array of values.
+         * 
+         * @param[out] vals Values read.
+         * @param[in] count Number of values.
+         */
+        template <typename T>
+        void getArray(T * vals, const size_t count) {
+            getBytes(vals, count * sizeof(T));
+        }
+
+        /** Returns where the next value would be read, or null. */
+        const uint8_t * cursor(void) const { return mOk ? mBuffer + mPos : nullptr; }
+
+        /** Returns the number of payload bytes left. */
+        size_t remaining(void) const { return mOk ? mEnd - mPos : 0; }
+
+        /**
+         * Skips over bytes read directly through cursor, i.e. a nested
+         * snapshot.
+         * 
+         * @param[in] count Number of bytes read. 0 marks a failed read.
+         */
+        void advance(const size_t count) {
+            if (count == 0 || count > remaining()) {
+                mOk = false;
+                return;
+            }
+            mPos += count;
+        }
+
+        /** Returns whether every read succeeded and the payload was consumed. */
+        bool isValid(void) const { return mOk && mPos == mEnd; }
+
+        /** Returns whether every read so far succeeded. */
+        bool isOk(void) const { return mOk; }
+
+    private:
+        void getBytes(void * dst, const size_t count) {
+            if (!mOk || count > mEnd - mPos) {
+                mOk = false;
+                return;
+            }
+            memcpy(dst, mBuffer + mPos, count);
+            mPos += count;
+        }
+
+    private:
+        const uint8_t * mBuffer;
+        size_t mEnd;
+        size_t mPos;
+        bool mOk;
+};
@@ -0,0 +1,216 @@
+/**
+ * Maximum Power Point Tracker Project
+ * 
+ * File: FirFilter.h
+ * Author: Matthew Yu
+ * Organization: UT Solar Vehicles Team
+ * Created on: October 17th, 2026
+ * Last Modified: 10/17/26
+ * 
+ * File Description: This header file implements the FirFilter class, which is a
+ * derived class from the parent Filter class. It is a finite impulse response
+ * filter with N taps; with symmetric coefficients (as FirDesign produces) it is
+ * linear phase, so every frequency is delayed by the same (N - 1) / 2 samples.
+ * 
+ * The delay line is stored twice, back to back. Each sample is written to both
+ * copies, so the newest N samples are always one contiguous run and the output
+ * is a plain dot product with no wrap handling. The dot product keeps four
+ * independent partial sums, which the compiler maps onto SIMD lanes. It is
+ * evaluated lazily: adding samples only updates the delay line, and the dot
+ * product runs on the next getResult.
+ * 
+ * The FirDesign class generates coefficients; every design function is
+ * constexpr, so coefficient tables can be computed at compile time:
+ * 
+ *     constexpr auto lowPass = FirDesign::windowedSincLowPass<31>(100, 10000);
+ *     FirFilter<31> filter(lowPass);
+ * 
+ * Snapshots hold the delay line, newest sample first.
+ * 
+ * Source: https://www.dspguide.com/ch16.htm
+ */
+#pragma once
+#include "Filter.h"
+#include "FilterState.h"
+#include "ConstexprMath.h"
+
+/** Coefficients (taps) of an N tap FIR filter. */
+template <size_t N>
+struct FirCoefficients {
+    float tap[N];
+};
+
+class FirDesign final {
+    public:
+        /**
+         * Designs a linear phase low pass filter by a Hamming windowed sinc,
+         * normalized to unity DC gain.
+         * 
+         * @param[in] cutoff Cutoff frequency, in Hz.
+         * @param[in] sampleRate Sample rate, in Hz.
+         * @return Filter taps.
+         * @precondition 0 < cutoff < sampleRate / 2.
+         */
+        template <size_t N>
+        static constexpr FirCoefficients<N> windowedSincLowPass(
+            const double cutoff,
+            const double sampleRate
+        ) {
+            static_assert(N > 0, "A FIR filter needs at least one tap.");
+            const double fc = cutoff / sampleRate;
+            const double middle = (N - 1) / 2.0;
+            double taps[N] = {};
+            double sum = 0;
+            for (size_t n = 0; n < N; ++n) {
+                const double x = n - middle;
+                double sinc = 2.0 * fc;
+                if (x != 0) {
+                    sinc = ConstexprMath::sin(2.0 * ConstexprMath::PI * fc * x)
+                        / (ConstexprMath::PI * x);
+                }
+                double window = 1.0;
+                if (N > 1) {
+                    window = 0.54 - 0.46 * ConstexprMath::cos(2.0 * ConstexprMath::PI * n / (N - 1));
+                }
+                taps[n] = sinc * window;
+                sum += taps[n];
+            }
+
+            FirCoefficients<N> coeffs{};
+            for (size_t n = 0; n < N; ++n) { coeffs.tap[n] = (float) (taps[n] / sum); }
+            return coeffs;
+        }
+
+        /**
+         * Designs an N sample moving average, the FIR equivalent of SmaFilter.
+         * 
+         * @return Filter taps.
+         */
+        template <size_t N>
+        static constexpr FirCoefficients<N> movingAverage(void) {
+            FirCoefficients<N> coeffs{};
+            for (size_t n = 0; n < N; ++n) { coeffs.tap[n] = (float) (1.0 / N); }
+            return coeffs;
+        }
+};
+
+/**
+ * @tparam N Number of taps. Must be positive.
+ */
+template <size_t N>
+class FirFilter final : public Filter {
+    static_assert(N > 0, "A FIR filter needs at least one tap.");
+
+    public:
+        /**
+         * Constructor for a FirFilter object.
+         * 
+         * @param[in] coeffs Filter taps, i.e. from FirDesign. tap[0] weighs
+         *                   the newest sample.
+         */
+        constexpr FirFilter(const FirCoefficients<N> & coeffs) :
+            Filter(N), mCoeffs(coeffs), mDelay{}, mIdx(0), mDirty(false) {}
+
+        void addSample(const float sample) override {
+            push(sample);
+            mDirty = true;
+        }
+
+        void addSamples(const float * samples, const size_t numSamples) override {
+            for (size_t i = 0; i < numSamples; ++i) { push(samples[i]); }
+            if (numSamples > 0) { mDirty = true; }
+        }
+
+        void filterSamples(
+            const float * samples,
+            float * results,
+            const size_t numSamples
+        ) override {
+            for (size_t i = 0; i < numSamples; ++i) {
+                push(samples[i]);
+                results[i] = dot();
+            }
+            if (numSamples > 0) {
+                mCurrentVal = results[numSamples - 1];
+                mDirty = false;
+            }
+        }
+
+        /** Returns the filter output, computing it if samples were added. */
+        float getResult(void) const override {
+            if (mDirty) {
+                mCurrentVal = dot();
+                mDirty = false;
+            }
+            return mCurrentVal;
+        }
+
+        void clear(void) override {
+            for (size_t i = 0; i < 2 * N; ++i) { mDelay[i] = 0; }
+            mIdx = 0;
+            mCurrentVal = 0;
+            mDirty = false;
+        }
+
+        size_t serialize(uint8_t * buffer, const size_t len) const override {
+            FilterStateWriter writer(buffer, len, FilterState::FIR);
+            writer.putArray(mDelay + mIdx, N);
+            return writer.finish();
+        }
+
+        bool deserialize(const uint8_t * buffer, const size_t len) override {
+            FilterStateReader reader(buffer, len, FilterState::FIR);
+            /* Check the size up front, so the delay line can be read in place. */
+            if (!reader.isOk() || reader.remaining() != N * sizeof(float)) {
+                return false;
+            }
+            reader.getArray(mDelay, N);
+            for (size_t k = 0; k < N; ++k) { mDelay[k + N] = mDelay[k]; }
+            mIdx = 0;
+            mDirty = true;
+            return true;
+        }
+
+    private:
+        /**
+         * Writes a sample into both copies of the delay line. The index moves
+         * backwards so that mDelay[mIdx] is the newest sample and
+         * mDelay[mIdx + k] is k samples old.
+         * 
+         * @param[in] sample Input value.
+         */
+        inline void push(const float sample) {
+            mIdx = (mIdx == 0) ? N - 1 : mIdx - 1;
+            mDelay[mIdx] = sample;
+            mDelay[mIdx + N] = sample;
+        }
+
+        /** Returns the dot product of the taps with the newest N samples. */
+        inline float dot(void) const {
+            const float * x = mDelay + mIdx;
+            const float * h = mCoeffs.tap;
+            float acc[4] = {0, 0, 0, 0};
+            for (size_t k = 0; k < N / 4 * 4; k += 4) {
+                acc[0] += h[k] * x[k];
+                acc[1] += h[k + 1] * x[k + 1];
+                acc[2] += h[k + 2] * x[k + 2];
+                acc[3] += h[k + 3] * x[k + 3];
+            }
+            float sum = (acc[0] + acc[1]) + (acc[2] + acc[3]);
+            for (size_t k = N / 4 * 4; k < N; ++k) { sum += h[k] * x[k]; }
+            return sum;
+        }
+
+    private:
+        /** Filter taps. */
+        FirCoefficients<N> mCoeffs;
+
+        /** Delay line, stored twice back to back. */
+        float mDelay[2 * N];
+
+        /** Index of the newest sample in the delay line. */
+        size_t mIdx;
+
+        /** Whether samples were added since the output was last computed. */
+        mutable bool mDirty;
+};
@@ -0,0 +1,159 @@
+/**
+ * Maximum Power Point Tracker Project
+ * 
+ * File: FixedPoint.h
+ * Author: Matthew Yu
+ * Organization: UT Solar Vehicles Team
+ * Created on: October 17th, 2026
+ * Last Modified: 10/17/26
+ * 
+ * File Description: This header file describes the Q15 and Q31 fixed point
+ * formats and the saturating arithmetic helpers used by the fixed point filter
+ * family (SmaFilterQ, EmaFilterQ, KalmanFilterQ). These filters are meant for
+ * parts without an FPU, such as Cortex-M0+ nodes, where soft-float makes each
+ * float filter update cost hundreds of cycles.
+ * 
+ * Samples fed to the fixed point filters are raw integer codes (i.e. an ADC
+ * code, or AnalogIn::read_u16() >> 1 when treated as a Q15 fraction). Only
+ * filter coefficients, such as the EMA alpha or the Kalman gain, are Q
+ * fractions in [-1, 1).
+ */
+#pragma once
+#include <stdint.h>
+#include <limits>
+
+/** Q15 format. 16 bit samples and coefficients with 15 fractional bits. */
+struct Q15 {
+    /** Sample and coefficient storage. */
+    typedef int16_t Sample;
+    /** Running sums over a window of samples. */
+    typedef int32_t Accum;
+    /** Recursive filter state, holding STATE_SHIFT extra fractional bits. */
+    typedef int32_t State;
+    /** Intermediate products. */
+    typedef int64_t Wide;
+
+    static constexpr int FRAC_BITS = 15;
+    static constexpr int STATE_SHIFT = 15;
+};
+
+/** Q31 format. 32 bit samples and coefficients with 31 fractional bits. */
+struct Q31 {
+    typedef int32_t Sample;
+    typedef int64_t Accum;
+    typedef int64_t State;
+    typedef int64_t Wide;
+
+    static constexpr int FRAC_BITS = 31;
+    static constexpr int STATE_SHIFT = 16;
+};
+
+/**
+ * Clamps a value into the range of a narrower integer type.
+ * 
+ * @tparam T Destination type.
+ * @param[in] val Value to clamp.
+ * @return Saturated value.
+ */
+template <typename T, typename W>
+constexpr T saturate(const W val) {
+    return (val > (W) std::numeric_limits<T>::max()) ? std::numeric_limits<T>::max() :
+           (val < (W) std::numeric_limits<T>::min()) ? std::numeric_limits<T>::min() :
+           (T) val;
+}
+
+/**
+ * Arithmetic right shift with round half up.
+ * 
+ * @param[in] val Value to shift.
+ * @param[in] shift Number of bits to shift by. May be 0.
+ * @return Rounded, shifted value.
+ */
+template <typename W>
+constexpr W roundShift(const W val, const int shift) {
+    return (shift == 0) ? val : (val + ((W) 1 << (shift - 1))) >> shift;
+}
+
+/**
+ * Converts a float in [-1, 1) to a saturated Q fraction.
+ * 
+ * @tparam Q Q15 or Q31.
+ * @param[in] val Value to convert.
+ * @return Q fraction.
+ */
+template <typename Q>
+constexpr typename Q::Sample toQ(const float val) {
+    return saturate<typename Q::Sample>((typename Q::Wide) (
+        (double) val * (double) ((typename Q::Wide) 1 << Q::FRAC_BITS)
+        + ((val >= 0) ? 0.5 : -0.5)));
+}
+
+/**
+ * Converts a Q fraction to a float.
+ * 
+ * @tparam Q Q15 or Q31.
+ * @param[in] val Q fraction to convert.
+ * @return Value in [-1, 1).
+ */
+template <typename Q>
+constexpr float fromQ(const typename Q::Sample val) {
+    return (float) ((double) val / (double) ((typename Q::Wide) 1 << Q::FRAC_BITS));
+}
+
+/**
+ * Multiplies a value by a Q fraction, rounding: val * coeff >> FRAC_BITS.
+ * A Q31 state is as wide as the product type, so its product is formed from
+ * 32 bit halves of the value to stay within 64 bits.
+ * 
+ * @tparam Q Q15 or Q31.
+ * @param[in] val Value, within the range of Q::State.
+ * @param[in] coeff Q fraction.
+ * @return Rounded product.
+ */
+template <typename Q>
+inline typename Q::Wide mulQ(const typename Q::Wide val, const typename Q::Sample coeff) {
+    typedef typename Q::Wide Wide;
+    if (sizeof(typename Q::State) < sizeof(Wide)) {
+        return roundShift(val * coeff, Q::FRAC_BITS);
+    }
+    const Wide high = val >> 32;
+    const Wide low = val & 0xFFFFFFFF;
+    return high * coeff * ((Wide) 1 << (32 - Q::FRAC_BITS))
+        + roundShift(low * coeff, Q::FRAC_BITS);
+}
+
+/**
+ * Moves a recursive filter state towards a sample by a Q fraction of the
+ * difference, saturating instead of wrapping: state += coeff * (sample - state).
+ * 
+ * @tparam Q Q15 or Q31.
+ * @param[in] state Current state, with Q::STATE_SHIFT extra fractional bits.
+ * @param[in] sample New sample.
+ * @param[in] coeff Q fraction in [0, 1).
+ * @return Updated state.
+ */
+template <typename Q>
+inline typename Q::State blendQ(
+    const typename Q::State state,
+    const typename Q::Sample sample,
+    const typename Q::Sample coeff
+) {
+    typedef typename Q::State State;
+    typedef typename Q::Wide Wide;
+    State err = saturate<State>(
+        (Wide) sample * ((Wide) 1 << Q::STATE_SHIFT) - (Wide) state);
+    return saturate<State>((Wide) state + mulQ<Q>(err, coeff));
+}
+
+/**
+ * Converts a recursive filter state back into a sample.
+ * 
+ * @tparam Q Q15 or Q31.
+ * @param[in] state State with Q::STATE_SHIFT extra fractional bits.
+ * @return Rounded sample.
+ */
+template <typename Q>
+inline typename Q::Sample stateToSample(const typename Q::State state) {
+    return saturate<typename Q::Sample>(
+        roundShift((typename Q::Wide) state, Q::STATE_SHIFT));
+}
@@ -0,0 +1,198 @@
+/**
+ * Maximum Power Point Tracker Project
+ * 
+ * File: GoertzelFilter.h
+ * Author: Matthew Yu
+ * Organization: UT Solar Vehicles Team
+ * Created on: October 17th, 2026
+ * Last Modified: 10/17/26
+ * 
+ * File Description: This header file implements the GoertzelFilter class,
+ * which is a derived class from the parent Filter class. It measures the
+ * amplitude of a few frequency bins, i.e. converter switching ripple or twice
+ * the line frequency on a current sensor, without a full FFT. Each bin runs
+ * the Goertzel recurrence s = x + 2cos(w) s1 - s2, one multiply and two adds
+ * per sample, and its magnitude is computed once per block of samples.
+ * 
+ * Magnitudes are scaled to the amplitude of a sinusoid at the bin frequency,
+ * so a ripple of A peak reads as A. They are updated at the end of each block
+ * and held until the next one completes. Leakage from DC and neighboring
+ * frequencies is smallest when each bin holds a whole number of cycles per
+ * block, that is when frequency * blockSize / sampleRate is an integer.
+ * Snapshots hold the recurrence states of the current block and the last
+ * magnitudes.
+ * 
+ * Source: https://en.wikipedia.org/wiki/Goertzel_algorithm
+ */
+#pragma once
+#include "Filter.h"
+#include "FilterState.h"
+#include "ConstexprMath.h"
+#include <cmath>
+
+/**
+ * @tparam Bins Number of frequency bins. Must be positive.
+ */
+template <size_t Bins>
+class GoertzelFilter final : public Filter {
+    static_assert(Bins > 0, "A Goertzel filter needs at least one bin.");
+
+    public:
+        /**
+         * Constructor for a GoertzelFilter object.
+         * 
+         * @param[in] frequencies Bin frequencies, in Hz.
+         * @param[in] sampleRate Sample rate, in Hz.
+         * @param[in] blockSize Number of samples per magnitude update.
+         * @precondition 0 <= frequencies < sampleRate / 2, blockSize is a
+         *               positive number.
+         */
+        constexpr GoertzelFilter(
+            const float (& frequencies)[Bins],
+            const float sampleRate,
+            const uint16_t blockSize
+        ) :
+            Filter(blockSize), mCoeff{}, mS1{}, mS2{}, mMagnitude{}, mCount(0),
+            mScale(2.0f / blockSize)
+        {
+            for (size_t b = 0; b < Bins; ++b) {
+                mCoeff[b] = (float) (2 * ConstexprMath::cos(
+                    2 * ConstexprMath::PI * frequencies[b] / sampleRate));
+            }
+        }
+
+        void addSample(const float sample) override {
+            for (size_t b = 0; b < Bins; ++b) {
+                const float s = sample + mCoeff[b] * mS1[b] - mS2[b];
+                mS2[b] = mS1[b];
+                mS1[b] = s;
+            }
+            if (++mCount == mMaxSamples) { finishBlock(); }
+        }
+
+        void addSamples(const float * samples, const size_t numSamples) override {
+            size_t i = 0;
+            while (i < numSamples) {
+                size_t n = mMaxSamples - mCount;
+                if (n > numSamples - i) { n = numSamples - i; }
+
+                /* Each recurrence is a serial dependency chain, so step every
+                   bin per sample to overlap them, from local copies. */
+                float s1[Bins];
+                float s2[Bins];
+                for (size_t b = 0; b < Bins; ++b) {
+                    s1[b] = mS1[b];
+                    s2[b] = mS2[b];
+                }
+                for (size_t j = 0; j < n; ++j) {
+                    const float x = samples[i + j];
+                    for (size_t b = 0; b < Bins; ++b) {
+                        const float s = x + mCoeff[b] * s1[b] - s2[b];
+                        s2[b] = s1[b];
+                        s1[b] = s;
+                    }
+                }
+                for (size_t b = 0; b < Bins; ++b) {
+                    mS1[b] = s1[b];
+                    mS2[b] = s2[b];
+                }
+
+                i += n;
+                mCount += n;
+                if (mCount == mMaxSamples) { finishBlock(); }
+            }
+        }
+
+        void filterSamples(
+            const float * samples,
+            float * results,
+            const size_t numSamples
+        ) override {
+            for (size_t i = 0; i < numSamples; ++i) {
+                GoertzelFilter::addSample(samples[i]);
+                results[i] = mMagnitude[0];
+            }
+        }
+
+        /** Returns the magnitude of the first bin from the last full block. */
+        float getResult(void) const override { return mMagnitude[0]; }
+
+        /**
+         * Returns the magnitude of a bin from the last full block.
+         * 
+         * @param[in] bin Bin index.
+         * @return Amplitude at the bin frequency, or 0 if bin is out of range.
+         */
+        float getMagnitude(const size_t bin) const {
+            return (bin < Bins) ? mMagnitude[bin] : 0;
+        }
+
+        void clear(void) override {
+            for (size_t b = 0; b < Bins; ++b) {
+                mS1[b] = 0;
+                mS2[b] = 0;
+                mMagnitude[b] = 0;
+            }
+            mCount = 0;
+        }
+
+        size_t serialize(uint8_t * buffer, const size_t len) const override {
+            FilterStateWriter writer(buffer, len, FilterState::GOERTZEL);
+            writer.putArray(mS1, Bins);
+            writer.putArray(mS2, Bins);
+            writer.putArray(mMagnitude, Bins);
+            writer.put(mCount);
+            return writer.finish();
+        }
+
+        bool deserialize(const uint8_t * buffer, const size_t len) override {
+            FilterStateReader reader(buffer, len, FilterState::GOERTZEL);
+            float s1[Bins];
+            float s2[Bins];
+            float magnitude[Bins];
+            uint16_t count = 0;
+            reader.getArray(s1, Bins);
+            reader.getArray(s2, Bins);
+            reader.getArray(magnitude, Bins);
+            reader.get(count);
+            /* A partial block from a larger block size would never finish. */
+            if (!reader.isValid() || count >= mMaxSamples) { return false; }
+            for (size_t b = 0; b < Bins; ++b) {
+                mS1[b] = s1[b];
+                mS2[b] = s2[b];
+                mMagnitude[b] = magnitude[b];
+            }
+            mCount = count;
+            return true;
+        }
+
+    private:
+        /** Computes every bin's magnitude and restarts the recurrences. */
+        void finishBlock(void) {
+            for (size_t b = 0; b < Bins; ++b) {
+                const float power = mS1[b] * mS1[b] + mS2[b] * mS2[b]
+                    - mCoeff[b] * mS1[b] * mS2[b];
+                mMagnitude[b] = sqrtf((power > 0) ? power : 0) * mScale;
+                mS1[b] = 0;
+                mS2[b] = 0;
+            }
+            mCount = 0;
+        }
+
+    private:
+        /** Recurrence coefficients, 2cos(2 pi f / fs). */
+        float mCoeff[Bins];
+
+        /** Recurrence states, one and two samples old. */
+        float mS1[Bins];
+        float mS2[Bins];
+
+        /** Bin magnitudes from the last full block. */
+        float mMagnitude[Bins];
+
+        /** Number of samples in the current block. */
+        uint16_t mCount;
+
+        /** Converts a bin magnitude into a sinusoid amplitude. */
+        float mScale;
+};
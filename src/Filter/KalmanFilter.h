@@ -5,46 +5,69 @@
  * Author: Matthew Yu
  * Organization: UT Solar Vehicles Team
  * Created on: September 20th, 2020
- * Last Modified: 06/08/21
+ * Last Modified: 10/17/26
  * 
  * File Description: This header file implements the KalmanFilter class, which
  * is a derived class from the parent Filter class.
  * 
- * Source: https://www.kalmanfilter.net/kalman1d.html
+ * With constant measurement uncertainty R and process noise variance Q, the
+ * Kalman gain converges to a fixed value after a few dozen samples. The gain
+ * mode selects whether the gain is recomputed every sample (DYNAMIC), fixed at
+ * the closed form steady state value (STEADY_STATE), or recomputed until it
+ * converges and then fixed (AUTO). A fixed gain reduces each update to a
+ * single multiply-add.
+ * 
+ * The ADAPTIVE mode instead estimates R and Q online by covariance matching.
+ * For the random walk model, measurement differences over one and two samples
+ * have E[(z_k - z_k-1)^2] = 2R + Q and E[(z_k - z_k-2)^2] = 2R + 2Q, which
+ * gives R independently of the filter (and unaffected by steps in the input).
+ * The innovation d = z - x (before the update) has E[d^2] = P' + R for the
+ * prior uncertainty P', and the steady state relation Q = P'^2 / (P' + R)
+ * gives Q. The means are exponentially weighted over a window of maxSamples
+ * samples, so the filter quiets down on a steady signal and opens up again as
+ * soon as the input moves (i.e. irradiance changes under clouds).
+ * 
+ * Sources:
+ * https://www.kalmanfilter.net/kalman1d.html
+ * https://doi.org/10.1007/s001900050236 (Mohamed and Schwarz, Adaptive Kalman
+ * filtering for INS/GPS)
  */
 #pragma once
 #include "Filter.h"
-#include <stdio.h>
+#include "FilterState.h"
+#include "ConstexprMath.h"
+
+/** Relative change in gain below which AUTO mode fixes the gain. */
+#define KALMAN_GAIN_TOLERANCE 1e-4f
+
+/** Lower bound on the R and Q estimates of the ADAPTIVE mode. */
+#define KALMAN_ADAPTIVE_MIN_VARIANCE 1e-6f
 
 class KalmanFilter final : public Filter {
+    public:
+        enum GainMode {DYNAMIC, STEADY_STATE, AUTO, ADAPTIVE};
+
     public:
         /** Default constructor for a KalmanFilter object. 10 sample size. */
-        KalmanFilter(void) : Filter(10) {            
-            mEstimate = 10.0;
-            mEu = 225;
-            mMu = 25;
-            mQ = 0.15;
-        }
+        KalmanFilter(void) : Filter(10) { init(10.0, 225, 25, 0.15); }
         
         /**
          * Constructor for a KalmanFilter object.
          * 
          * @param[in] maxSamples Number of samples that the filter should hold at maximum 
-         *      at any one time.
+         *      at any one time. Sets the window of the ADAPTIVE mode.
          * @precondition maxSamples is a positive number.
          */
         KalmanFilter(const uint16_t maxSamples) : Filter(maxSamples) {
-            mEstimate = 10.0;
-            mEu = 225;
-            mMu = 25;
-            mQ = 0.15;
+            init(10.0, 225, 25, 0.15);
         }
 
         /**
          * Constructor for a KalmanFilter object.
          * 
          * @param[in] maxSamples Number of samples that the filter should hold at 
-         *                       maximum at any one time.
+         *                       maximum at any one time. Sets the window of the
+         *                       ADAPTIVE mode.
          * @param[in] initialEstimate Initial guess of a sensor sample value. A 
          *                       best guess would be at STC (i.e. Temp sensor:
          *                       25.0 C, 128 cell subarray - .65V each: 85.0 V,
@@ -59,6 +82,8 @@ class KalmanFilter final : public Filter {
          * @param[in] processNoiseVariance Measurement of how good we think our model 
          *                       is. Recommended range is 0.15 to 0.001. Play
          *                       around with this value.
+         * @param[in] gainMode How the Kalman gain is updated. Defaults to
+         *                       recomputing it every sample.
          * @precondition maxSamples is a positive number.
          */
         KalmanFilter(
@@ -66,34 +91,287 @@ class KalmanFilter final : public Filter {
             const float initialEstimate,
             const float estimateUncertainty,
             const float measurementUncertainty,
-            const float processNoiseVariance
+            const float processNoiseVariance,
+            const enum GainMode gainMode = DYNAMIC
         ) : Filter(maxSamples) {
+            init(
+                initialEstimate, 
+                estimateUncertainty, 
+                measurementUncertainty, 
+                processNoiseVariance);
+            setGainMode(gainMode);
+        }
+
+        /**
+         * Returns the Kalman gain the filter converges to for a constant
+         * measurement uncertainty and process noise variance. The prior
+         * estimate uncertainty P then satisfies P = P R / (P + R) + Q, so
+         * P = (Q + sqrt(Q^2 + 4 Q R)) / 2 and K = P / (P + R).
+         * 
+         * @param[in] measurementUncertainty Measurement uncertainty R.
+         * @param[in] processNoiseVariance Process noise variance Q.
+         * @return Steady state gain in [0, 1].
+         */
+        static constexpr float steadyStateGain(
+            const float measurementUncertainty,
+            const float processNoiseVariance
+        ) {
+            return (float) (steadyStateUncertainty(measurementUncertainty, processNoiseVariance)
+                / (steadyStateUncertainty(measurementUncertainty, processNoiseVariance)
+                   + (double) measurementUncertainty));
+        }
+
+        /**
+         * Selects how the Kalman gain is updated. STEADY_STATE fixes the gain
+         * immediately; AUTO fixes it once it stops changing; ADAPTIVE keeps it
+         * dynamic and estimates R and Q online, starting from their current
+         * values.
+         * 
+         * @param[in] gainMode New gain mode.
+         */
+        void setGainMode(const enum GainMode gainMode) {
+            mGainMode = gainMode;
+            mFixedGain = false;
+            if (gainMode == STEADY_STATE) { fixGain(); }
+            /* Seed the statistics with the current noise model. */
+            mDiffVar[0] = 2 * mMu + mQ;
+            mDiffVar[1] = 2 * mMu + 2 * mQ;
+            mInnovationVar = mEu + mMu;
+            mHistory = 0;
+        }
+
+        /**
+         * Sets the measurement uncertainty, i.e. from a noise variance measured
+         * online with a VarianceFilter. The steady state gain is recomputed,
+         * so AUTO mode converges on the new value, and a fixed gain switches
+         * to it.
+         * 
+         * @param[in] measurementUncertainty New measurement variance.
+         */
+        void setMeasurementUncertainty(const float measurementUncertainty) {
+            mMu = measurementUncertainty;
+            mK = steadyStateGain(mMu, mQ);
+            if (mFixedGain) { mEu = (float) steadyStateUncertainty(mMu, mQ); }
+        }
+
+        /** Returns the measurement uncertainty, estimated in ADAPTIVE mode. */
+        float getMeasurementUncertainty(void) const { return mMu; }
+
+        /** Returns the process noise variance, estimated in ADAPTIVE mode. */
+        float getProcessNoiseVariance(void) const { return mQ; }
+
+        /** Returns whether updates are using a fixed gain. */
+        bool isGainFixed(void) const { return mFixedGain; }
+
+        /** Returns the current Kalman gain. */
+        float getGain(void) const { return mFixedGain ? mK : mEu / (mEu + mMu); }
+
+        void addSample(const float sample) override { 
+            update(sample, mEstimate, mEu);
+        }
+
+        void addSamples(const float * samples, const size_t numSamples) override {
+            /* Keep the state in locals so it stays in registers. */
+            float estimate = mEstimate;
+            size_t i = 0;
+            if (!mFixedGain) {
+                float eu = mEu;
+                for (; i < numSamples && !mFixedGain; ++i) {
+                    update(samples[i], estimate, eu);
+                }
+                mEu = eu;
+            }
+            const float K = mK;
+            for (; i < numSamples; ++i) {
+                estimate += K * (samples[i] - estimate);
+            }
+            mEstimate = estimate;
+        }
+
+        void filterSamples(
+            const float * samples,
+            float * results,
+            const size_t numSamples
+        ) override {
+            float estimate = mEstimate;
+            size_t i = 0;
+            if (!mFixedGain) {
+                float eu = mEu;
+                for (; i < numSamples && !mFixedGain; ++i) {
+                    update(samples[i], estimate, eu);
+                    results[i] = estimate;
+                }
+                mEu = eu;
+            }
+            const float K = mK;
+            for (; i < numSamples; ++i) {
+                estimate += K * (samples[i] - estimate);
+                results[i] = estimate;
+            }
+            mEstimate = estimate;
+        }
+
+        float getResult(void) const override { return mEstimate; }
+
+        /** Resets the estimate and its uncertainty to the initial values. */
+        void clear(void) override {
+            mEstimate = mInitEstimate;
+            mEu = mInitEu;
+            setGainMode(mGainMode);
+        }
+
+        /**
+         * Writes the estimate, its uncertainty, the noise model and the gain
+         * state, so a restored filter resumes without converging again.
+         */
+        size_t serialize(uint8_t * buffer, const size_t len) const override {
+            FilterStateWriter writer(buffer, len, FilterState::KALMAN);
+            writer.put(mEstimate);
+            writer.put(mEu);
+            writer.put(mMu);
+            writer.put(mQ);
+            writer.putArray(mDiffVar, 2);
+            writer.put(mInnovationVar);
+            writer.putArray(mPrevSample, 2);
+            writer.put(mHistory);
+            writer.put(mK);
+            writer.put((uint8_t) mFixedGain);
+            return writer.finish();
+        }
+
+        bool deserialize(const uint8_t * buffer, const size_t len) override {
+            FilterStateReader reader(buffer, len, FilterState::KALMAN);
+            float estimate = 0;
+            float eu = 0;
+            float mu = 0;
+            float q = 0;
+            float diffVar[2] = {0, 0};
+            float innovationVar = 0;
+            float prevSample[2] = {0, 0};
+            uint8_t history = 0;
+            float K = 0;
+            uint8_t fixedGain = 0;
+            reader.get(estimate);
+            reader.get(eu);
+            reader.get(mu);
+            reader.get(q);
+            reader.getArray(diffVar, 2);
+            reader.get(innovationVar);
+            reader.getArray(prevSample, 2);
+            reader.get(history);
+            reader.get(K);
+            reader.get(fixedGain);
+            if (!reader.isValid()) { return false; }
+            mEstimate = estimate;
+            mEu = eu;
+            mMu = mu;
+            mQ = q;
+            mDiffVar[0] = diffVar[0];
+            mDiffVar[1] = diffVar[1];
+            mInnovationVar = innovationVar;
+            mPrevSample[0] = prevSample[0];
+            mPrevSample[1] = prevSample[1];
+            mHistory = history;
+            mK = K;
+            mFixedGain = fixedGain != 0;
+            return true;
+        }
+
+    private:
+        /** Sets the model parameters and the initial state. */
+        void init(
+            const float initialEstimate,
+            const float estimateUncertainty,
+            const float measurementUncertainty,
+            const float processNoiseVariance
+        ) {
+            mInitEstimate = initialEstimate;
+            mInitEu = estimateUncertainty;
             mEstimate = initialEstimate;
             mEu = estimateUncertainty;
             mMu = measurementUncertainty;
             mQ = processNoiseVariance;
+            mAdaptRate = 1.0f / mMaxSamples;
+            mK = steadyStateGain(mMu, mQ);
+            setGainMode(DYNAMIC);
         }
 
-        void addSample(const float sample) override { 
+        /** Returns the steady state prior estimate uncertainty. */
+        static constexpr double steadyStateUncertainty(
+            const float measurementUncertainty,
+            const float processNoiseVariance
+        ) {
+            return ((double) processNoiseVariance + ConstexprMath::sqrt(
+                (double) processNoiseVariance * processNoiseVariance
+                + 4.0 * processNoiseVariance * measurementUncertainty)) / 2.0;
+        }
+
+        /** Switches to the fixed, steady state gain. */
+        void fixGain(void) {
+            mK = steadyStateGain(mMu, mQ);
+            mEu = (float) steadyStateUncertainty(mMu, mQ);
+            mFixedGain = true;
+        }
+
+        /**
+         * Runs a single update/predict step.
+         * 
+         * @param[in] sample Input measurement.
+         * @param[in,out] estimate Current estimate.
+         * @param[in,out] eu Current estimate uncertainty.
+         */
+        inline void update(const float sample, float & estimate, float & eu) {
+            if (mFixedGain) {
+                estimate += mK * (sample - estimate);
+                return;
+            }
+
             /* Kalman Gain. */
-            double K = mEu / (mEu + mMu);
+            float K = eu / (eu + mMu);
             /* Estimate update (state update). */
-            mEstimate = mEstimate + K * (sample - mEstimate);
+            const float innovation = sample - estimate;
+            estimate = estimate + K * innovation;
             /* Estimate uncertainty. */
-            mEu = (1-K) * mEu;
+            eu = (1-K) * eu;
+            if (mGainMode == ADAPTIVE) { adapt(sample, innovation); }
             /* Predict estimate. */
-            // mEstimate = mEstimate;
+            // estimate = estimate;
             /* Predict estimate uncertainty. */
-            mEu = mEu + mQ;
+            eu = eu + mQ;
+
+            /* Fix the gain once it has settled on the steady state value. */
+            if (mGainMode == AUTO && K - mK <= KALMAN_GAIN_TOLERANCE * mK
+                && mK - K <= KALMAN_GAIN_TOLERANCE * mK) {
+                mFixedGain = true;
+            }
         }
 
-        float getResult(void) const override { return mEstimate; }
+        /**
+         * Updates the R and Q estimates by covariance matching.
+         * 
+         * @param[in] sample Input measurement.
+         * @param[in] innovation Measurement minus the prior estimate.
+         */
+        inline void adapt(const float sample, const float innovation) {
+            if (mHistory == 2) {
+                const float diff1 = sample - mPrevSample[0];
+                const float diff2 = sample - mPrevSample[1];
+                mDiffVar[0] += mAdaptRate * (diff1 * diff1 - mDiffVar[0]);
+                mDiffVar[1] += mAdaptRate * (diff2 * diff2 - mDiffVar[1]);
+            } else {
+                ++mHistory;
+            }
+            mPrevSample[1] = mPrevSample[0];
+            mPrevSample[0] = sample;
+            mInnovationVar += mAdaptRate * (innovation * innovation - mInnovationVar);
 
-        void clear(void) override {
-            mEstimate = 10.0;
-            mEu = 225;
-            mMu = 25;
-            mQ = 0.15;
+            mMu = mDiffVar[0] - mDiffVar[1] / 2;
+            if (mMu < KALMAN_ADAPTIVE_MIN_VARIANCE) { mMu = KALMAN_ADAPTIVE_MIN_VARIANCE; }
+
+            /* Prior uncertainty implied by the innovations. */
+            const float prior = mInnovationVar - mMu;
+            mQ = (prior > 0) ? prior * prior / mInnovationVar : 0.0f;
+            if (mQ < KALMAN_ADAPTIVE_MIN_VARIANCE) { mQ = KALMAN_ADAPTIVE_MIN_VARIANCE; }
         }
 
     private:
@@ -108,21 +386,28 @@ class KalmanFilter final : public Filter {
 
         /** Process noise variance. */
         float mQ;
-};
 
+        /** Initial values, restored on clear. */
+        float mInitEstimate;
+        float mInitEu;
+
+        /** Steady state Kalman gain. */
+        float mK;
 
-void TEST() {
-    printf("Hello World Test\n");
-    // setup
-    KalmanFilter filter(5); // 5 sample buffer
-    // add 20 samples, increasing linearly by 10, and then some noisy 100s every 5 cycles.
-    for (uint16_t i = 0; i < 20; i++) {
-        if (i%5 == 0) { filter.addSample(100); } 
-        else { filter.addSample(i*10.0); }
-    
-        // read the filter output at every point
-        printf("output:\t%f\n\n", filter.getResult());
-    }
-    // shutdown
-    filter.shutdown();
-}
\ No newline at end of file
+        /** Gain update mode, and whether the gain is currently fixed. */
+        enum GainMode mGainMode;
+        bool mFixedGain;
+
+        /** ADAPTIVE mode: weighted means of the squared one and two sample
+            measurement differences and of the squared innovation. */
+        float mDiffVar[2];
+        float mInnovationVar;
+
+        /** ADAPTIVE mode: the last two measurements, newest first, and how
+            many of them are valid. */
+        float mPrevSample[2];
+        uint8_t mHistory;
+
+        /** ADAPTIVE mode: weight of each new sample in the means. */
+        float mAdaptRate;
+};
@@ -0,0 +1,243 @@
+/**
+ * Maximum Power Point Tracker Project
+ * 
+ * File: KalmanFilterN.h
+ * Author: Matthew Yu
+ * Organization: UT Solar Vehicles Team
+ * Created on: October 17th, 2026
+ * Last Modified: 10/17/26
+ * 
+ * File Description: This header file implements the KalmanFilterN class, a
+ * multi dimensional Kalman filter with a kinematic model, which is a derived
+ * class from the parent Filter class.
+ * 
+ * The state vector is [position, rate, acceleration, ...] truncated to States
+ * entries, so States = 2 is a constant velocity model and States = 3 is a
+ * constant acceleration model. Unlike the scalar KalmanFilter, the model
+ * predicts forward each sample, so the estimate tracks ramps (i.e. MPPT voltage
+ * sweeps) without lag. Process noise enters through the highest derivative as
+ * discrete white noise.
+ * 
+ * The first Measurements states are measured directly (position, then
+ * optionally rate) with independent noise, so measurements are folded in one
+ * at a time and no matrix inversion is needed.
+ * 
+ * Snapshots hold the state estimate and its covariance; the model and noise
+ * settings are configuration and come from the constructor.
+ * 
+ * Source: https://www.kalmanfilter.net/multiSummary.html
+ */
+#pragma once
+#include "Filter.h"
+#include "FilterState.h"
+#include "Matrix.h"
+
+/**
+ * @tparam States Number of kinematic states tracked. Must be positive.
+ * @tparam Measurements Number of states measured directly, from position up.
+ *                      Must be in [1, States].
+ */
+template <size_t States, size_t Measurements = 1>
+class KalmanFilterN final : public Filter {
+    static_assert(States > 0, "KalmanFilterN requires at least one state.");
+    static_assert(Measurements > 0 && Measurements <= States,
+        "KalmanFilterN measurements must be in [1, States].");
+
+    public:
+        typedef Matrix<States, 1> StateVector;
+        typedef Matrix<States, States> StateMatrix;
+
+    public:
+        /**
+         * Constructor for a KalmanFilterN object.
+         * 
+         * @param[in] timeStep Time between samples, in seconds.
+         * @param[in] initialEstimate Initial guess of the position. Higher
+         *                       derivatives start at 0.
+         * @param[in] estimateUncertainty Initial estimate uncertainty variance
+         *                       of every state.
+         * @param[in] measurementUncertainty Uncertainty (variance) of each
+         *                       input measurement.
+         * @param[in] processNoiseVariance Variance of the white noise driving
+         *                       the highest tracked derivative.
+         * @precondition timeStep and measurementUncertainty are positive.
+         */
+        KalmanFilterN(
+            const float timeStep,
+            const float initialEstimate,
+            const float estimateUncertainty,
+            const float measurementUncertainty,
+            const float processNoiseVariance
+        ) : Filter(1) {
+            mInitEstimate = initialEstimate;
+            mInitEu = estimateUncertainty;
+            mQVariance = processNoiseVariance;
+            for (size_t m = 0; m < Measurements; ++m) {
+                mMu[m] = measurementUncertainty;
+            }
+            setTimeStep(timeStep);
+            clear();
+        }
+
+        /**
+         * Updates the time between samples and rebuilds the model.
+         * 
+         * @param[in] timeStep Time between samples, in seconds.
+         */
+        void setTimeStep(const float timeStep) {
+            /* Transition: F(i, j) = dt^(j - i) / (j - i)! for j >= i. */
+            mF = StateMatrix::identity();
+            Matrix<States, 1> G;
+            float term = 1;
+            for (size_t k = 1; k <= States; ++k) {
+                term *= timeStep / k;
+                for (size_t i = 0; i + k < States; ++i) { mF(i, i + k) = term; }
+                /* Noise gain: G(i) = dt^(States - i) / (States - i)!. */
+                G[States - k] = term;
+            }
+            mQ = (G * G.transpose()) * mQVariance;
+        }
+
+        /**
+         * Sets the measurement uncertainty of one measured state.
+         * 
+         * @param[in] measurement Index of the measured state.
+         * @param[in] measurementUncertainty Variance of that measurement.
+         */
+        void setMeasurementUncertainty(
+            const size_t measurement,
+            const float measurementUncertainty
+        ) {
+            mMu[measurement] = measurementUncertainty;
+        }
+
+        /** Predicts one step and folds in a position measurement. */
+        void addSample(const float sample) override {
+            predict();
+            correct(0, sample);
+        }
+
+        void addSamples(const float * samples, const size_t numSamples) override {
+            for (size_t i = 0; i < numSamples; ++i) {
+                predict();
+                correct(0, samples[i]);
+            }
+        }
+
+        void filterSamples(
+            const float * samples,
+            float * results,
+            const size_t numSamples
+        ) override {
+            for (size_t i = 0; i < numSamples; ++i) {
+                predict();
+                correct(0, samples[i]);
+                results[i] = mX[0];
+            }
+        }
+
+        /**
+         * Predicts one step and folds in a full measurement.
+         * 
+         * @param[in] measurement Measured values of the first Measurements
+         *                        states (position, rate, ...).
+         */
+        void addMeasurement(const float (&measurement)[Measurements]) {
+            predict();
+            for (size_t m = 0; m < Measurements; ++m) {
+                correct(m, measurement[m]);
+            }
+        }
+
+        /** Returns the position estimate. */
+        float getResult(void) const override { return mX[0]; }
+
+        /** Returns the rate estimate, or 0 for a constant model. */
+        float getRate(void) const { return (States > 1) ? mX[1 % States] : 0; }
+
+        /** Returns the full state estimate. */
+        const StateVector & getState(void) const { return mX; }
+
+        /** Returns the state estimate covariance. */
+        const StateMatrix & getCovariance(void) const { return mP; }
+
+        /** Resets the state and covariance to the initial values. */
+        void clear(void) override {
+            mX = StateVector();
+            mX[0] = mInitEstimate;
+            mP = StateMatrix::identity() * mInitEu;
+        }
+
+        size_t serialize(uint8_t * buffer, const size_t len) const override {
+            FilterStateWriter writer(buffer, len, FilterState::KALMAN_N);
+            writer.put(mX);
+            writer.put(mP);
+            return writer.finish();
+        }
+
+        bool deserialize(const uint8_t * buffer, const size_t len) override {
+            FilterStateReader reader(buffer, len, FilterState::KALMAN_N);
+            StateVector x;
+            StateMatrix p;
+            reader.get(x);
+            reader.get(p);
+            if (!reader.isValid()) { return false; }
+            mX = x;
+            mP = p;
+            return true;
+        }
+
+    private:
+        /** Predict state and estimate uncertainty one time step ahead. */
+        void predict(void) {
+            mX = mF * mX;
+            mP = mF * mP * mF.transpose() + mQ;
+        }
+
+        /**
+         * Folds in a direct measurement of a single state.
+         * 
+         * @param[in] idx Index of the measured state.
+         * @param[in] z Measured value.
+         */
+        void correct(const size_t idx, const float z) {
+            /* Innovation covariance; H selects row idx of P. */
+            const float S = mP(idx, idx) + mMu[idx];
+            const float innovation = z - mX[idx];
+
+            /* Kalman Gain, K = P H^T / S. */
+            StateVector K;
+            for (size_t i = 0; i < States; ++i) { K[i] = mP(i, idx) / S; }
+
+            /* State update. */
+            for (size_t i = 0; i < States; ++i) { mX[i] += K[i] * innovation; }
+
+            /* Covariance update, P = P - K H P. */
+            Matrix<1, States> row;
+            for (size_t j = 0; j < States; ++j) { row(0, j) = mP(idx, j); }
+            mP = mP - K * row;
+        }
+
+    private:
+        /** State estimate. */
+        StateVector mX;
+
+        /** Estimate covariance. */
+        StateMatrix mP;
+
+        /** State transition model. */
+        StateMatrix mF;
+
+        /** Process noise covariance. */
+        StateMatrix mQ;
+
+        /** Measurement uncertainty of each measured state. */
+        float mMu[Measurements];
+
+        /** Process noise variance of the highest derivative. */
+        float mQVariance;
+
+        /** Initial values, restored on clear. */
+        float mInitEstimate;
+        float mInitEu;
+};
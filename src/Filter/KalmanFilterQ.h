@@ -0,0 +1,144 @@
+/**
+ * Maximum Power Point Tracker Project
+ * 
+ * File: KalmanFilterQ.h
+ * Author: Matthew Yu
+ * Organization: UT Solar Vehicles Team
+ * Created on: October 17th, 2026
+ * Last Modified: 10/17/26
+ * 
+ * File Description: This header file implements the KalmanFilterQ class, a
+ * fixed point, saturating version of the scalar KalmanFilter over raw integer
+ * sample codes. See FixedPoint.h.
+ * 
+ * The uncertainties are tracked relative to the measurement uncertainty R,
+ * which keeps them dimensionless and independent of the sample scale. With
+ * p = P / R and q = Q / R, the scalar update reduces to:
+ *     K  = p / (p + 1)
+ *     p' = (1 - K) p + q = K + q
+ * so each sample costs one division to find the gain and one multiply-add to
+ * move the estimate. p and q are held as unsigned 16.16 fixed point.
+ * 
+ * Source: https://www.kalmanfilter.net/kalman1d.html
+ */
+#pragma once
+#include "FixedPoint.h"
+#include <stddef.h>
+
+/**
+ * @tparam Q Q15 or Q31. Selects the sample and gain widths.
+ */
+template <typename Q>
+class KalmanFilterQ final {
+    public:
+        typedef typename Q::Sample Sample;
+        typedef typename Q::State State;
+
+    public:
+        /**
+         * Constructor for a KalmanFilterQ object. Arguments are in the same
+         * units as KalmanFilter, with raw sample codes as the measurement
+         * unit.
+         * 
+         * @param[in] initialEstimate Initial guess of a sample code.
+         * @param[in] estimateUncertainty Estimate uncertainty variance.
+         * @param[in] measurementUncertainty Uncertainty of the input measurement.
+         * @param[in] processNoiseVariance Measurement of how good we think our
+         *                       model is.
+         * @precondition measurementUncertainty is a positive number and
+         *               estimateUncertainty / measurementUncertainty < 65536.
+         */
+        constexpr KalmanFilterQ(
+            const float initialEstimate,
+            const float estimateUncertainty,
+            const float measurementUncertainty,
+            const float processNoiseVariance
+        ) :
+            mInitEstimate(toState(initialEstimate)),
+            mInitP(toUq16(estimateUncertainty / measurementUncertainty)),
+            mEstimate(mInitEstimate),
+            mP(mInitP),
+            mQ(toUq16(processNoiseVariance / measurementUncertainty)) {}
+
+        /**
+         * Adds a sample to the filter and updates calculations.
+         * 
+         * @param[in] sample Raw sample code.
+         */
+        void addSample(const Sample sample) {
+            mEstimate = blendQ<Q>(mEstimate, sample, update());
+        }
+
+        /**
+         * Adds a block of samples to the filter in order.
+         * 
+         * @param[in] samples Pointer to the raw sample codes.
+         * @param[in] numSamples Number of samples.
+         */
+        void addSamples(const Sample * samples, const size_t numSamples) {
+            State estimate = mEstimate;
+            for (size_t i = 0; i < numSamples; ++i) {
+                estimate = blendQ<Q>(estimate, samples[i], update());
+            }
+            mEstimate = estimate;
+        }
+
+        /**
+         * Returns the filtered result of the input data.
+         * 
+         * @return Current estimate, rounded to the nearest code.
+         */
+        Sample getResult(void) const { return stateToSample<Q>(mEstimate); }
+
+        /** Resets the estimate and its uncertainty to the initial values. */
+        void clear(void) {
+            mEstimate = mInitEstimate;
+            mP = mInitP;
+        }
+
+    private:
+        /** 1.0 in unsigned 16.16 fixed point. */
+        static constexpr uint32_t UQ16_ONE = (uint32_t) 1 << 16;
+
+        /** Converts a sample code to a saturated filter state. */
+        static constexpr State toState(const float val) {
+            return saturate<State>((typename Q::Wide) (
+                (double) val * (double) ((typename Q::Wide) 1 << Q::STATE_SHIFT)
+                + ((val >= 0) ? 0.5 : -0.5)));
+        }
+
+        /** Converts a non-negative ratio to saturated unsigned 16.16. */
+        static constexpr uint32_t toUq16(const float val) {
+            return (val <= 0) ? 0 :
+                saturate<uint32_t>((uint64_t) ((double) val * UQ16_ONE + 0.5));
+        }
+
+        /**
+         * Computes the Kalman gain for the next sample and advances the
+         * relative uncertainty.
+         * 
+         * @return Kalman gain as a Q fraction.
+         */
+        Sample update(void) {
+            /* Kalman Gain. p < 2^32, so the shifted numerator fits. */
+            Sample K = (Sample) (((uint64_t) mP << Q::FRAC_BITS) / ((uint64_t) mP + UQ16_ONE));
+            /* Estimate uncertainty, then predict estimate uncertainty. */
+            uint64_t p = (((uint64_t) K << 16) >> Q::FRAC_BITS) + mQ;
+            mP = saturate<uint32_t>(p);
+            return K;
+        }
+
+    private:
+        /** Initial values, restored on clear. */
+        State mInitEstimate;
+        uint32_t mInitP;
+
+        /** Guess, with extra fraction bits. */
+        State mEstimate;
+
+        /** Estimate uncertainty relative to the measurement uncertainty. */
+        uint32_t mP;
+
+        /** Process noise variance relative to the measurement uncertainty. */
+        uint32_t mQ;
+};
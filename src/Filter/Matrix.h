@@ -0,0 +1,84 @@
+/**
+ * Maximum Power Point Tracker Project
+ * 
+ * File: Matrix.h
+ * Author: Matthew Yu
+ * Organization: UT Solar Vehicles Team
+ * Created on: October 17th, 2026
+ * Last Modified: 10/17/26
+ * 
+ * File Description: This header file implements the Matrix class, a small
+ * fixed size, row major float matrix used by the multi dimensional filters.
+ * Dimensions are template parameters, so storage lives on the stack or inside
+ * the owning object and every loop has a compile time trip count that the
+ * compiler can fully unroll.
+ */
+#pragma once
+#include <stddef.h>
+#include <array>
+
+template <size_t R, size_t C>
+class Matrix {
+    public:
+        /** Constructor for a zero filled Matrix object. */
+        constexpr Matrix(void) : mData{} {}
+
+        /** Returns an identity matrix. */
+        static Matrix identity(void) {
+            static_assert(R == C, "Identity matrices must be square.");
+            Matrix m;
+            for (size_t i = 0; i < R; ++i) { m(i, i) = 1; }
+            return m;
+        }
+
+        /** Element access by row and column. */
+        float & operator()(const size_t r, const size_t c) { return mData[r * C + c]; }
+        float operator()(const size_t r, const size_t c) const { return mData[r * C + c]; }
+
+        /** Element access for column vectors. */
+        float & operator[](const size_t r) { return mData[r]; }
+        float operator[](const size_t r) const { return mData[r]; }
+
+        Matrix<C, R> transpose(void) const {
+            Matrix<C, R> m;
+            for (size_t r = 0; r < R; ++r) {
+                for (size_t c = 0; c < C; ++c) { m(c, r) = (*this)(r, c); }
+            }
+            return m;
+        }
+
+        Matrix operator+(const Matrix & other) const {
+            Matrix m;
+            for (size_t i = 0; i < R * C; ++i) { m.mData[i] = mData[i] + other.mData[i]; }
+            return m;
+        }
+
+        Matrix operator-(const Matrix & other) const {
+            Matrix m;
+            for (size_t i = 0; i < R * C; ++i) { m.mData[i] = mData[i] - other.mData[i]; }
+            return m;
+        }
+
+        Matrix operator*(const float scale) const {
+            Matrix m;
+            for (size_t i = 0; i < R * C; ++i) { m.mData[i] = mData[i] * scale; }
+            return m;
+        }
+
+        template <size_t K>
+        Matrix<R, K> operator*(const Matrix<C, K> & other) const {
+            Matrix<R, K> m;
+            for (size_t r = 0; r < R; ++r) {
+                for (size_t k = 0; k < K; ++k) {
+                    float sum = 0;
+                    for (size_t c = 0; c < C; ++c) { sum += (*this)(r, c) * other(c, k); }
+                    m(r, k) = sum;
+                }
+            }
+            return m;
+        }
+
+    private:
+        /** Row major elements. */
+        std::array<float, R * C> mData;
+};
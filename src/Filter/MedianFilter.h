@@ -5,24 +5,27 @@
  * Author: Matthew Yu
  * Organization: UT Solar Vehicles Team
  * Created on: September 19th, 2020
- * Last Modified: 06/08/21
+ * Last Modified: 10/17/26
  * 
  * File Description: This header file implements the MedianFilter class, which
- * is a derived class from the parent Filter class.
+ * is a derived class from the parent Filter class. The sliding window median
+ * is maintained by a MedianHeap; see MedianHeap.h.
+ * 
+ * MedianFilterN is a compile time sized variant that keeps its window inside
+ * the object, so it needs no heap and can be constructed in static memory.
+ * 
+ * Snapshots hold the window samples, oldest first, and are restored by
+ * replaying them.
  */
 #pragma once
 #include "Filter.h"
-#include <cmath>
-#include <algorithm>
+#include "MedianHeap.h"
+#include "FilterState.h"
 
 class MedianFilter final : public Filter {
     public:
         /** Default constructor for a MedianFilter object. 10 sample size. */
-        MedianFilter(void) : Filter(10) {
-            mDataBuffer = new float[mMaxSamples];
-            mIdx = 0;
-            mNumSamples = 0;
-        }
+        MedianFilter(void) : Filter(10), mMedian(10) {}
 
         /**
          * Constructor for a MedianFilter object.
@@ -31,87 +34,131 @@ class MedianFilter final : public Filter {
          *      hold at maximum at any one time.
          * @precondition maxSamples is a positive number.
          */
-        MedianFilter(const uint16_t maxSamples) : Filter(maxSamples) {
-            mDataBuffer = new float[mMaxSamples];
-            mIdx = 0;
-            mNumSamples = 0;
+        MedianFilter(const uint16_t maxSamples) :
+            Filter(maxSamples), mMedian(maxSamples) {}
+
+        void addSample(const float sample) override { mMedian.add(sample); }
+
+        void addSamples(const float * samples, const size_t numSamples) override {
+            for (size_t i = 0; i < numSamples; ++i) {
+                mMedian.add(samples[i]);
+            }
         }
 
-        void addSample(const float sample) override { 
-            /* Check for exception. */
-            if (mDataBuffer == nullptr) { return; }
-            
-            /* Saturate counter at max samples. */
-            if (mNumSamples < mMaxSamples) {
-                mNumSamples ++;
+        void filterSamples(
+            const float * samples,
+            float * results,
+            const size_t numSamples
+        ) override {
+            for (size_t i = 0; i < numSamples; ++i) {
+                mMedian.add(samples[i]);
+                results[i] = mMedian.getMedian();
             }
-        
-            mDataBuffer[mIdx] = sample;
-            mIdx = (mIdx + 1) % mMaxSamples;
         }
 
-        float getResult(void) const override { 
-            /* Check for exception. */
-            if (mDataBuffer == nullptr) { return 0.0; }
+        float getResult(void) const override { return mMedian.getMedian(); }
 
-            /* Get the range window. */
-            uint16_t startIdx = (mIdx - mNumSamples + mMaxSamples) % mMaxSamples;
+        void clear(void) override { mMedian.clear(); }
 
-            /* Find the median from that range window. */
-            return getMedian(startIdx);
+        size_t serialize(uint8_t * buffer, const size_t len) const override {
+            FilterStateWriter writer(buffer, len, FilterState::MEDIAN);
+            const uint16_t numSamples = mMedian.size();
+            writer.put(numSamples);
+            for (uint16_t i = 0; i < numSamples; ++i) {
+                writer.put(mMedian.sample(i));
+            }
+            return writer.finish();
         }
 
-        void clear(void) override {
-            mNumSamples = 0;
-            mIdx = 0;
+        bool deserialize(const uint8_t * buffer, const size_t len) override {
+            FilterStateReader reader(buffer, len, FilterState::MEDIAN);
+            uint16_t numSamples = 0;
+            reader.get(numSamples);
+            if (!reader.isOk() || reader.remaining() != numSamples * sizeof(float)) {
+                return false;
+            }
+            mMedian.clear();
+            for (uint16_t i = 0; i < numSamples; ++i) {
+                float sample = 0;
+                reader.get(sample);
+                mMedian.add(sample);
+            }
+            return true;
         }
 
         /** Deallocates constructs in the filter for shutdown. */
-        void shutdown(void) override { delete[] mDataBuffer; }
+        void shutdown(void) override { mMedian.release(); }
 
     private:
-        /**
-         * Returns the median of the data buffer.
-         * 
-         * @param[in] startIdx Start index of the data buffer.
-         * @return Median of the data buffer.
-         */
-        float getMedian(const uint16_t startIdx) const {
-            /* Naive solution is to sort the data and pick the n/2 index. */
-            float * tempBuffer = new  float[mNumSamples];
-            if (tempBuffer != nullptr) {
-                for (uint16_t i = 0; i < mNumSamples; i++) {
-                    tempBuffer[i] = mDataBuffer[(i + startIdx) % mMaxSamples];
-                }
-                
-                /* Sort the buffer. */
-                std::sort(tempBuffer, tempBuffer + mNumSamples);
-                
-                /* Get the correct index value. */
-                float val = 0.0;
-                if (mNumSamples == 0) { 
-                    return 0.0;
-                } else if (mNumSamples%2 == 0) {
-                    /* Even, split the median between two values. */
-                    val = (tempBuffer[mNumSamples/2] + tempBuffer[mNumSamples/2 - 1]) / 2.0;
-                } else {
-                    val = tempBuffer[(uint16_t) floor(mNumSamples/2)];
-                }
-                
-                delete[] tempBuffer;
-                return val;
-            } else {
-                return 0.0;
+        /** Sliding window median engine with heap allocated storage. */
+        MedianHeap<0> mMedian;
+};
+
+/**
+ * Compile time sized MedianFilter. Power of two windows waste no ring buffer
+ * slots.
+ * 
+ * @tparam N Number of samples that the filter should hold at maximum at any
+ *           one time. Must be positive.
+ */
+template <uint16_t N>
+class MedianFilterN final : public Filter {
+    static_assert(N > 0, "MedianFilterN requires a positive window size.");
+
+    public:
+        /** Constructor for a MedianFilterN object. */
+        constexpr MedianFilterN(void) : Filter(N), mMedian(N) {}
+
+        void addSample(const float sample) override { mMedian.add(sample); }
+
+        void addSamples(const float * samples, const size_t numSamples) override {
+            for (size_t i = 0; i < numSamples; ++i) {
+                mMedian.add(samples[i]);
             }
         }
 
-    private:
-        /** Data Buffer.  */
-        float * mDataBuffer;
+        void filterSamples(
+            const float * samples,
+            float * results,
+            const size_t numSamples
+        ) override {
+            for (size_t i = 0; i < numSamples; ++i) {
+                mMedian.add(samples[i]);
+                results[i] = mMedian.getMedian();
+            }
+        }
+
+        float getResult(void) const override { return mMedian.getMedian(); }
 
-        /** Number of samples in the buffer. */
-        uint16_t mNumSamples;
+        void clear(void) override { mMedian.clear(); }
 
-        /** Current index in the buffer. */
-        uint16_t mIdx;
+        size_t serialize(uint8_t * buffer, const size_t len) const override {
+            FilterStateWriter writer(buffer, len, FilterState::MEDIAN);
+            const uint16_t numSamples = mMedian.size();
+            writer.put(numSamples);
+            for (uint16_t i = 0; i < numSamples; ++i) {
+                writer.put(mMedian.sample(i));
+            }
+            return writer.finish();
+        }
+
+        bool deserialize(const uint8_t * buffer, const size_t len) override {
+            FilterStateReader reader(buffer, len, FilterState::MEDIAN);
+            uint16_t numSamples = 0;
+            reader.get(numSamples);
+            if (!reader.isOk() || reader.remaining() != numSamples * sizeof(float)) {
+                return false;
+            }
+            mMedian.clear();
+            for (uint16_t i = 0; i < numSamples; ++i) {
+                float sample = 0;
+                reader.get(sample);
+                mMedian.add(sample);
+            }
+            return true;
+        }
+
+    private:
+        /** Sliding window median engine with in-object storage. */
+        MedianHeap<N> mMedian;
 };
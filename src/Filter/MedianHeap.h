@@ -0,0 +1,305 @@
+/**
+ * Maximum Power Point Tracker Project
+ * 
+ * File: MedianHeap.h
+ * Author: Matthew Yu
+ * Organization: UT Solar Vehicles Team
+ * Created on: October 17th, 2026
+ * Last Modified: 10/17/26
+ * 
+ * File Description: This header file implements the MedianHeap class, the
+ * sliding window median engine shared by MedianFilter and MedianFilterN.
+ * 
+ * The median is maintained incrementally with a pair of indexed heaps over the
+ * sample window: a max heap holding the lower half of the window and a min heap
+ * holding the upper half. The window is a RingBuffer, and each of its slots
+ * remembers where it sits in the heaps, so replacing the oldest sample is an
+ * in place heap update: the newest sample takes over the oldest one's heap
+ * entry. add is O(log n), getMedian is O(1), and no allocations are performed
+ * after construction.
+ * 
+ * The template parameter N selects the storage. N > 0 stores the window inside
+ * the object; N == 0 allocates a window of runtime size on the heap, which must
+ * be released with release(). Power of two windows waste no ring slots.
+ */
+#pragma once
+#include <stdint.h>
+#include <array>
+#include "../RingBuffer/RingBuffer.h"
+
+/** In-object storage for a window of N samples. */
+template <uint16_t N>
+struct MedianStorage {
+    constexpr MedianStorage(const uint16_t) : window(), heap{}, pos{} {}
+    constexpr bool valid(void) const { return true; }
+    constexpr uint16_t capacity(void) const { return N; }
+    void release(void) {}
+
+    RingBuffer<float, ringCapacity(N)> window;
+    std::array<uint16_t, N> heap;
+    std::array<uint16_t, ringCapacity(N)> pos;
+};
+
+/** Heap allocated storage for a window sized at runtime. */
+template <>
+struct MedianStorage<0> {
+    MedianStorage(const uint16_t maxSamples) :
+        window(maxSamples),
+        heap(new uint16_t[maxSamples]),
+        pos(new uint16_t[ringCapacity(maxSamples)]),
+        size(maxSamples) {}
+    bool valid(void) const { return window.valid(); }
+    uint16_t capacity(void) const { return size; }
+    void release(void) {
+        window.release();
+        delete[] heap;
+        delete[] pos;
+        heap = nullptr;
+        pos = nullptr;
+    }
+
+    RingBuffer<float, 0> window;
+    uint16_t * heap;
+    uint16_t * pos;
+    uint16_t size;
+};
+
+template <uint16_t N>
+class MedianHeap {
+    public:
+        /**
+         * Constructor for a MedianHeap object.
+         * 
+         * @param[in] maxSamples Size of the window. Ignored if N > 0.
+         * @precondition The window size is a positive number.
+         */
+        constexpr MedianHeap(const uint16_t maxSamples) :
+            mStore(maxSamples),
+            mLowCap((mStore.capacity() + 1) / 2),
+            mLowSize(0),
+            mHighSize(0) {}
+
+        /**
+         * Adds a sample to the window, evicting the oldest sample if full.
+         * 
+         * @param[in] sample Input value.
+         */
+        void add(const float sample) {
+            /* Check for exception. */
+            if (!mStore.valid()) { return; }
+
+            auto & window = mStore.window;
+            const uint16_t numSamples = window.size();
+            if (numSamples < mStore.capacity()) {
+                /* Window is still filling; insert a new slot into the heaps. */
+                window.push(sample);
+                insert(window.slotOf(numSamples));
+            } else {
+                /* Window is full; the new slot takes over the heap entry of
+                   the oldest one, so restore ordering around it. */
+                const uint16_t oldest = window.slotOf(0);
+                window.consume(1);
+                window.push(sample);
+                const uint16_t slot = window.slotOf(numSamples - 1);
+                const uint16_t pos = mStore.pos[oldest];
+                mStore.heap[pos] = slot;
+                mStore.pos[slot] = pos;
+                replace(slot);
+            }
+        }
+
+        /**
+         * Returns the median of the window.
+         * 
+         * @return Median, or 0 if the window is empty.
+         */
+        float getMedian(void) const {
+            /* Check for exception. */
+            if (!mStore.valid() || mStore.window.empty()) { return 0.0; }
+
+            if (mLowSize > mHighSize) {
+                /* Odd, the median is the top of the lower half. */
+                return value(0);
+            }
+            /* Even, split the median between two values. */
+            return (value(0) + value(mLowCap)) / 2.0;
+        }
+
+        /** Empties the window. */
+        void clear(void) {
+            mStore.window.clear();
+            mLowSize = 0;
+            mHighSize = 0;
+        }
+
+        /** Returns the number of samples in the window. */
+        uint16_t size(void) const { return mStore.window.size(); }
+
+        /**
+         * Returns a sample of the window by age.
+         * 
+         * @param[in] i Position in the window, 0 being the oldest sample.
+         * @precondition i is less than size().
+         * @return Sample value.
+         */
+        float sample(const uint16_t i) const { return mStore.window[i]; }
+
+        /** Releases heap allocated storage, if any. */
+        void release(void) { mStore.release(); }
+
+    private:
+        /**
+         * Returns the sample referenced by a heap position.
+         * 
+         * @param[in] pos Position in the heap array.
+         * @return Sample value.
+         */
+        float value(const uint16_t pos) const {
+            return mStore.window.atSlot(mStore.heap[pos]);
+        }
+
+        /**
+         * Returns whether the sample at heap position a should sit above the
+         * sample at heap position b. The lower half is a max heap, the upper
+         * half is a min heap.
+         */
+        bool before(const uint16_t a, const uint16_t b) const {
+            return (a < mLowCap) ? value(a) > value(b) : value(a) < value(b);
+        }
+
+        /** Swaps two heap entries and updates their back references. */
+        void swap(const uint16_t a, const uint16_t b) {
+            uint16_t slot = mStore.heap[a];
+            mStore.heap[a] = mStore.heap[b];
+            mStore.heap[b] = slot;
+            mStore.pos[mStore.heap[a]] = a;
+            mStore.pos[mStore.heap[b]] = b;
+        }
+
+        /**
+         * Moves an entry towards the root of its heap until ordered.
+         * 
+         * @param[in] base Heap array offset of the heap root.
+         * @param[in] i Index of the entry relative to base.
+         */
+        void siftUp(const uint16_t base, uint16_t i) {
+            while (i > 0) {
+                uint16_t parent = (i - 1) / 2;
+                if (!before(base + i, base + parent)) { break; }
+                swap(base + i, base + parent);
+                i = parent;
+            }
+        }
+
+        /**
+         * Moves an entry towards the leaves of its heap until ordered.
+         * 
+         * @param[in] base Heap array offset of the heap root.
+         * @param[in] size Number of entries in the heap.
+         * @param[in] i Index of the entry relative to base.
+         */
+        void siftDown(const uint16_t base, const uint16_t size, uint16_t i) {
+            while (true) {
+                uint32_t child = 2 * (uint32_t) i + 1;
+                if (child >= size) { break; }
+                if (child + 1 < size && before(base + child + 1, base + child)) {
+                    ++child;
+                }
+                if (!before(base + child, base + i)) { break; }
+                swap(base + i, base + child);
+                i = child;
+            }
+        }
+
+        /** Appends a window slot to the lower half. */
+        void pushLow(const uint16_t slot) {
+            mStore.heap[mLowSize] = slot;
+            mStore.pos[slot] = mLowSize;
+            siftUp(0, mLowSize++);
+        }
+
+        /** Appends a window slot to the upper half. */
+        void pushHigh(const uint16_t slot) {
+            mStore.heap[mLowCap + mHighSize] = slot;
+            mStore.pos[slot] = mLowCap + mHighSize;
+            siftUp(mLowCap, mHighSize++);
+        }
+
+        /** Removes and returns the top slot of the lower half. */
+        uint16_t popLow(void) {
+            uint16_t slot = mStore.heap[0];
+            swap(0, --mLowSize);
+            siftDown(0, mLowSize, 0);
+            return slot;
+        }
+
+        /** Removes and returns the top slot of the upper half. */
+        uint16_t popHigh(void) {
+            uint16_t slot = mStore.heap[mLowCap];
+            swap(mLowCap, mLowCap + --mHighSize);
+            siftDown(mLowCap, mHighSize, 0);
+            return slot;
+        }
+
+        /**
+         * Inserts a new window slot into the heaps. The lower half holds
+         * either the same number or one more sample than the upper half.
+         * 
+         * @param[in] slot Window slot of the new sample.
+         */
+        void insert(const uint16_t slot) {
+            /* Rebalance before pushing, so neither half ever holds more
+               entries than its region of the heap array. */
+            const float sample = mStore.window.atSlot(slot);
+            if (mLowSize == 0 || sample <= value(0)) {
+                if (mLowSize > mHighSize) { pushHigh(popLow()); }
+                pushLow(slot);
+            } else if (mHighSize < mLowSize) {
+                pushHigh(slot);
+            } else if (sample > value(mLowCap)) {
+                pushLow(popHigh());
+                pushHigh(slot);
+            } else {
+                /* Between the two tops; it becomes the new lower top. */
+                pushLow(slot);
+            }
+        }
+
+        /**
+         * Restores heap ordering after a slot took over another's heap entry.
+         * 
+         * @param[in] slot Window slot of the modified sample.
+         */
+        void replace(const uint16_t slot) {
+            uint16_t pos = mStore.pos[slot];
+            if (pos < mLowCap) {
+                siftUp(0, pos);
+                siftDown(0, mLowSize, mStore.pos[slot]);
+            } else {
+                siftUp(mLowCap, pos - mLowCap);
+                siftDown(mLowCap, mHighSize, mStore.pos[slot] - mLowCap);
+            }
+
+            /* Only the two tops can be out of order across the halves. */
+            if (mHighSize > 0 && value(0) > value(mLowCap)) {
+                swap(0, mLowCap);
+                siftDown(0, mLowSize, 0);
+                siftDown(mLowCap, mHighSize, 0);
+            }
+        }
+
+    private:
+        /**
+         * Sample window, heap array and heap positions. The heap array holds
+         * window slots; [0, mLowCap) is the max heap of the lower half,
+         * [mLowCap, capacity) is the min heap of the upper half.
+         */
+        MedianStorage<N> mStore;
+
+        /** Offset of the upper half in the heap array. */
+        uint16_t mLowCap;
+
+        /** Number of entries in the lower and upper halves. */
+        uint16_t mLowSize;
+        uint16_t mHighSize;
+};
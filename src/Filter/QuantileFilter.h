@@ -0,0 +1,226 @@
+/**
+ * Maximum Power Point Tracker Project
+ * 
+ * File: QuantileFilter.h
+ * Author: Matthew Yu
+ * Organization: UT Solar Vehicles Team
+ * Created on: October 17th, 2026
+ * Last Modified: 10/17/26
+ * 
+ * File Description: This header file implements the QuantileFilter class,
+ * which is a derived class from the parent Filter class. It estimates a
+ * quantile (i.e. p50, p95, p99) of every sample seen since the last clear with
+ * the P-square algorithm, which keeps five markers instead of the samples
+ * themselves, so memory and update cost are constant however long the stream
+ * runs. Markers 0 and 4 hold the exact minimum and maximum; markers 1 to 3
+ * track the p/2, p and (1+p)/2 quantiles and are nudged towards their desired
+ * ranks with piecewise parabolic interpolation.
+ * 
+ * Track several percentiles with one filter each. For a rolling report, read
+ * the result and clear() the filter at the end of each reporting period.
+ * 
+ * Source: Jain and Chlamtac, "The P2 Algorithm for Dynamic Calculation of
+ * Quantiles and Histograms Without Storing Observations", CACM 28(10), 1985.
+ */
+#pragma once
+#include "Filter.h"
+#include "FilterState.h"
+
+#define QUANTILE_MARKERS 5
+
+class QuantileFilter final : public Filter {
+    public:
+        /** Default constructor for a QuantileFilter object. Tracks the median. */
+        QuantileFilter(void) : Filter(QUANTILE_MARKERS) { init(0.5); }
+
+        /**
+         * Constructor for a QuantileFilter object.
+         * 
+         * @param[in] quantile Quantile to track, in [0, 1]. i.e. 0.95 for p95.
+         */
+        QuantileFilter(const float quantile) : Filter(QUANTILE_MARKERS) { init(quantile); }
+
+        void addSample(const float sample) override {
+            if (mCount < QUANTILE_MARKERS) {
+                /* Insertion sort the first samples into the markers. */
+                uint8_t i = mCount;
+                while (i > 0 && mHeights[i - 1] > sample) {
+                    mHeights[i] = mHeights[i - 1];
+                    --i;
+                }
+                mHeights[i] = sample;
+                ++mCount;
+                return;
+            }
+
+            /* Find the cell holding the sample, widening the extremes. */
+            uint8_t k;
+            if (sample < mHeights[0]) {
+                mHeights[0] = sample;
+                k = 0;
+            } else if (sample >= mHeights[4]) {
+                mHeights[4] = sample;
+                k = 3;
+            } else {
+                k = 0;
+                while (sample >= mHeights[k + 1]) { ++k; }
+            }
+
+            /* Shift the markers above the sample up a rank. */
+            for (uint8_t i = k + 1; i < QUANTILE_MARKERS; ++i) { ++mPositions[i]; }
+            for (uint8_t i = 1; i < QUANTILE_MARKERS - 1; ++i) {
+                mOffsets[i - 1] += mIncrements[i - 1] - ((i > k) ? 1 : 0);
+            }
+
+            /* Move the middle markers back towards their desired ranks. */
+            for (uint8_t i = 1; i < QUANTILE_MARKERS - 1; ++i) {
+                const float offset = mOffsets[i - 1];
+                const int32_t above = (int32_t) (mPositions[i + 1] - mPositions[i]);
+                const int32_t below = (int32_t) (mPositions[i - 1] - mPositions[i]);
+                if ((offset >= 1 && above > 1) || (offset <= -1 && below < -1)) {
+                    const int32_t d = (offset >= 1) ? 1 : -1;
+                    const float height = parabolic(i, d);
+                    if (mHeights[i - 1] < height && height < mHeights[i + 1]) {
+                        mHeights[i] = height;
+                    } else {
+                        mHeights[i] = linear(i, d);
+                    }
+                    mPositions[i] += d;
+                    mOffsets[i - 1] -= d;
+                }
+            }
+        }
+
+        void addSamples(const float * samples, const size_t numSamples) override {
+            for (size_t i = 0; i < numSamples; ++i) {
+                QuantileFilter::addSample(samples[i]);
+            }
+        }
+
+        void filterSamples(
+            const float * samples,
+            float * results,
+            const size_t numSamples
+        ) override {
+            for (size_t i = 0; i < numSamples; ++i) {
+                QuantileFilter::addSample(samples[i]);
+                results[i] = QuantileFilter::getResult();
+            }
+        }
+
+        /**
+         * Returns the quantile estimate. Exact until five samples have been
+         * seen, using the nearest rank.
+         */
+        float getResult(void) const override {
+            if (mCount == 0) { return 0; }
+            if (mCount < QUANTILE_MARKERS) {
+                return mHeights[(uint8_t) (mQuantile * (mCount - 1) + 0.5f)];
+            }
+            return mHeights[2];
+        }
+
+        /** Returns the tracked quantile. */
+        float getQuantile(void) const { return mQuantile; }
+
+        /** Returns the smallest sample seen since the last clear. */
+        float getMin(void) const { return mCount ? mHeights[0] : 0; }
+
+        /** Returns the largest sample seen since the last clear. */
+        float getMax(void) const { return mCount ? mHeights[mCount - 1] : 0; }
+
+        void clear(void) override {
+            for (uint8_t i = 0; i < QUANTILE_MARKERS; ++i) {
+                mHeights[i] = 0;
+                mPositions[i] = i;
+            }
+            /* Desired ranks start at 4 dn: {0, 2p, 4p, 2 + 2p, 4}. */
+            mOffsets[0] = 2 * mQuantile - 1;
+            mOffsets[1] = 4 * mQuantile - 2;
+            mOffsets[2] = 2 * mQuantile - 1;
+            mCount = 0;
+        }
+
+        size_t serialize(uint8_t * buffer, const size_t len) const override {
+            FilterStateWriter writer(buffer, len, FilterState::QUANTILE);
+            writer.put(mCount);
+            writer.putArray(mHeights, QUANTILE_MARKERS);
+            writer.putArray(mPositions, QUANTILE_MARKERS);
+            writer.putArray(mOffsets, QUANTILE_MARKERS - 2);
+            return writer.finish();
+        }
+
+        bool deserialize(const uint8_t * buffer, const size_t len) override {
+            FilterStateReader reader(buffer, len, FilterState::QUANTILE);
+            uint8_t count = 0;
+            float heights[QUANTILE_MARKERS];
+            uint32_t positions[QUANTILE_MARKERS];
+            float offsets[QUANTILE_MARKERS - 2];
+            reader.get(count);
+            reader.getArray(heights, QUANTILE_MARKERS);
+            reader.getArray(positions, QUANTILE_MARKERS);
+            reader.getArray(offsets, QUANTILE_MARKERS - 2);
+            if (!reader.isValid() || count > QUANTILE_MARKERS) { return false; }
+            mCount = count;
+            for (uint8_t i = 0; i < QUANTILE_MARKERS; ++i) {
+                mHeights[i] = heights[i];
+                mPositions[i] = positions[i];
+            }
+            for (uint8_t i = 0; i < QUANTILE_MARKERS - 2; ++i) {
+                mOffsets[i] = offsets[i];
+            }
+            return true;
+        }
+
+    private:
+        void init(const float quantile) {
+            mQuantile = quantile;
+            mIncrements[0] = quantile / 2;
+            mIncrements[1] = quantile;
+            mIncrements[2] = (1 + quantile) / 2;
+            clear();
+        }
+
+        /**
+         * Piecewise parabolic prediction of a marker's height after moving it
+         * by d ranks.
+         */
+        inline float parabolic(const uint8_t i, const int32_t d) const {
+            const float nBelow = (float) (int32_t) (mPositions[i] - mPositions[i - 1]);
+            const float nAbove = (float) (int32_t) (mPositions[i + 1] - mPositions[i]);
+            return mHeights[i] + d / (nBelow + nAbove) * (
+                (nBelow + d) * (mHeights[i + 1] - mHeights[i]) / nAbove +
+                (nAbove - d) * (mHeights[i] - mHeights[i - 1]) / nBelow);
+        }
+
+        /** Linear prediction, used when the parabola overshoots a neighbor. */
+        inline float linear(const uint8_t i, const int32_t d) const {
+            const float n = (float) (int32_t) (mPositions[i + d] - mPositions[i]);
+            return mHeights[i] + d * (mHeights[i + d] - mHeights[i]) / n;
+        }
+
+    private:
+        /** Tracked quantile. */
+        float mQuantile;
+
+        /** Marker heights, in ascending order. */
+        float mHeights[QUANTILE_MARKERS];
+
+        /**
+         * Marker ranks. Only differences between ranks are used, so these may
+         * wrap on very long streams.
+         */
+        uint32_t mPositions[QUANTILE_MARKERS];
+
+        /**
+         * Desired minus actual rank of the middle markers. Tracked directly so
+         * it does not lose precision as the ranks grow.
+         */
+        float mOffsets[QUANTILE_MARKERS - 2];
+
+        /** Desired rank increments of the middle markers per sample. */
+        float mIncrements[QUANTILE_MARKERS - 2];
+
+        /** Number of samples seen, up to QUANTILE_MARKERS. */
+        uint8_t mCount;
+};
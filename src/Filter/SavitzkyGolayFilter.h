@@ -0,0 +1,290 @@
+/**
+ * Maximum Power Point Tracker Project
+ * 
+ * File: SavitzkyGolayFilter.h
+ * Author: Matthew Yu
+ * Organization: UT Solar Vehicles Team
+ * Created on: October 17th, 2026
+ * Last Modified: 10/17/26
+ * 
+ * File Description: This header file implements the SavitzkyGolayFilter
+ * class, which is a derived class from the parent Filter class. It fits a
+ * polynomial to the newest N samples by least squares and reports the fit's
+ * value and first derivative at a chosen point of the window. Both are plain
+ * dot products of the window with fixed taps, so the derivative comes with
+ * the smoothing instead of being a noisy difference of two smoothed outputs.
+ * 
+ * The fit is evaluated lag samples back from the newest sample. A centered
+ * lag of (N - 1) / 2 smooths best; a lag of 0 has no delay but lets more
+ * noise through. Inputs that are polynomials of degree up to Order pass
+ * through exactly, derivative included.
+ * 
+ * The SavitzkyGolayDesign class generates the taps; it is constexpr, so they
+ * can be computed at compile time:
+ * 
+ *     constexpr auto fit = SavitzkyGolayDesign::fit<11, 2>(5);
+ *     SavitzkyGolayFilter<11> filter(fit, 0.001);
+ * 
+ * Like FirFilter, the window is stored twice back to back and the outputs are
+ * evaluated lazily, on the next getResult or getDerivative. Snapshots hold
+ * the window, newest sample first.
+ * 
+ * Source: https://en.wikipedia.org/wiki/Savitzky%E2%80%93Golay_filter
+ */
+#pragma once
+#include "Filter.h"
+#include "FilterState.h"
+
+/** Taps of an N sample Savitzky-Golay filter. tap[k] weighs the sample k old. */
+template <size_t N>
+struct SavitzkyGolayCoefficients {
+    /** Taps for the fitted value. */
+    float smooth[N];
+    /** Taps for the fitted first derivative, per sample. */
+    float slope[N];
+};
+
+class SavitzkyGolayDesign final {
+    public:
+        /**
+         * Designs the taps of a least squares polynomial fit.
+         * 
+         * @tparam N Window size.
+         * @tparam Order Polynomial degree, from 1 to N - 1.
+         * @param[in] lag Number of samples back from the newest sample at
+         *                which the fit is evaluated. At most N - 1.
+         * @return Filter taps.
+         */
+        template <size_t N, size_t Order>
+        static constexpr SavitzkyGolayCoefficients<N> fit(const size_t lag) {
+            static_assert(Order >= 1, "A derivative needs at least a linear fit.");
+            static_assert(Order < N, "The window must be longer than the fit order.");
+            constexpr size_t M = Order + 1;
+
+            /* Normal equations G = A^T A, with the sample k old at t = lag - k. */
+            double g[M][M] = {};
+            for (size_t k = 0; k < N; ++k) {
+                const double t = (double) lag - (double) k;
+                double power = 1;
+                double powers[2 * M - 1] = {};
+                for (size_t j = 0; j < 2 * M - 1; ++j) {
+                    powers[j] = power;
+                    power *= t;
+                }
+                for (size_t i = 0; i < M; ++i) {
+                    for (size_t j = 0; j < M; ++j) { g[i][j] += powers[i + j]; }
+                }
+            }
+
+            /* Solve G [z w] = [e0 e1] by Gauss-Jordan with partial pivoting. */
+            double rhs[M][2] = {};
+            rhs[0][0] = 1;
+            rhs[1][1] = 1;
+            for (size_t col = 0; col < M; ++col) {
+                size_t pivot = col;
+                for (size_t row = col + 1; row < M; ++row) {
+                    if (abs(g[row][col]) > abs(g[pivot][col])) { pivot = row; }
+                }
+                for (size_t j = 0; j < M; ++j) { swap(g[col][j], g[pivot][j]); }
+                swap(rhs[col][0], rhs[pivot][0]);
+                swap(rhs[col][1], rhs[pivot][1]);
+
+                for (size_t row = 0; row < M; ++row) {
+                    if (row == col) { continue; }
+                    const double factor = g[row][col] / g[col][col];
+                    for (size_t j = 0; j < M; ++j) { g[row][j] -= factor * g[col][j]; }
+                    rhs[row][0] -= factor * rhs[col][0];
+                    rhs[row][1] -= factor * rhs[col][1];
+                }
+            }
+
+            /* Tap k is the fit basis evaluated at t_k, weighted by z or w. */
+            SavitzkyGolayCoefficients<N> coeffs{};
+            for (size_t k = 0; k < N; ++k) {
+                const double t = (double) lag - (double) k;
+                double power = 1;
+                double smooth = 0;
+                double slope = 0;
+                for (size_t j = 0; j < M; ++j) {
+                    smooth += rhs[j][0] / g[j][j] * power;
+                    slope += rhs[j][1] / g[j][j] * power;
+                    power *= t;
+                }
+                coeffs.smooth[k] = (float) smooth;
+                coeffs.slope[k] = (float) slope;
+            }
+            return coeffs;
+        }
+
+    private:
+        static constexpr double abs(const double x) { return (x < 0) ? -x : x; }
+
+        static constexpr void swap(double & a, double & b) {
+            const double tmp = a;
+            a = b;
+            b = tmp;
+        }
+};
+
+/**
+ * @tparam N Window size. Must be positive.
+ */
+template <size_t N>
+class SavitzkyGolayFilter final : public Filter {
+    static_assert(N > 0, "A Savitzky-Golay filter needs at least one sample.");
+
+    public:
+        /**
+         * Constructor for a SavitzkyGolayFilter object.
+         * 
+         * @param[in] coeffs Filter taps, from SavitzkyGolayDesign.
+         * @param[in] timeStep Time between samples, in seconds. Scales the
+         *                     derivative.
+         * @precondition timeStep is a positive number.
+         */
+        constexpr SavitzkyGolayFilter(
+            const SavitzkyGolayCoefficients<N> & coeffs,
+            const float timeStep = 1
+        ) :
+            Filter(N), mCoeffs(coeffs), mDelay{}, mIdx(0), mInvDt(1.0f / timeStep),
+            mDerivative(0), mDirty(false), mDerivativeDirty(false) {}
+
+        void addSample(const float sample) override {
+            push(sample);
+            mDirty = true;
+            mDerivativeDirty = true;
+        }
+
+        void addSamples(const float * samples, const size_t numSamples) override {
+            for (size_t i = 0; i < numSamples; ++i) { push(samples[i]); }
+            if (numSamples > 0) {
+                mDirty = true;
+                mDerivativeDirty = true;
+            }
+        }
+
+        void filterSamples(
+            const float * samples,
+            float * results,
+            const size_t numSamples
+        ) override {
+            for (size_t i = 0; i < numSamples; ++i) {
+                push(samples[i]);
+                results[i] = dot(mCoeffs.smooth);
+            }
+            if (numSamples > 0) {
+                mCurrentVal = results[numSamples - 1];
+                mDirty = false;
+                mDerivativeDirty = true;
+            }
+        }
+
+        /** Returns the smoothed value, computing it if samples were added. */
+        float getResult(void) const override {
+            if (mDirty) {
+                mCurrentVal = dot(mCoeffs.smooth);
+                mDirty = false;
+            }
+            return mCurrentVal;
+        }
+
+        /**
+         * Returns the first derivative of the fit, in units per second,
+         * computing it if samples were added.
+         */
+        float getDerivative(void) const {
+            if (mDerivativeDirty) {
+                mDerivative = dot(mCoeffs.slope) * mInvDt;
+                mDerivativeDirty = false;
+            }
+            return mDerivative;
+        }
+
+        /**
+         * Updates the time between samples.
+         * 
+         * @param[in] timeStep Time between samples, in seconds.
+         * @precondition timeStep is a positive number.
+         */
+        void setTimeStep(const float timeStep) {
+            mInvDt = 1.0f / timeStep;
+            mDerivativeDirty = true;
+        }
+
+        void clear(void) override {
+            for (size_t i = 0; i < 2 * N; ++i) { mDelay[i] = 0; }
+            mIdx = 0;
+            mCurrentVal = 0;
+            mDerivative = 0;
+            mDirty = false;
+            mDerivativeDirty = false;
+        }
+
+        size_t serialize(uint8_t * buffer, const size_t len) const override {
+            FilterStateWriter writer(buffer, len, FilterState::SAVITZKY_GOLAY);
+            writer.putArray(mDelay + mIdx, N);
+            return writer.finish();
+        }
+
+        bool deserialize(const uint8_t * buffer, const size_t len) override {
+            FilterStateReader reader(buffer, len, FilterState::SAVITZKY_GOLAY);
+            /* Check the size up front, so the window can be read in place. */
+            if (!reader.isOk() || reader.remaining() != N * sizeof(float)) {
+                return false;
+            }
+            reader.getArray(mDelay, N);
+            for (size_t k = 0; k < N; ++k) { mDelay[k + N] = mDelay[k]; }
+            mIdx = 0;
+            mDirty = true;
+            mDerivativeDirty = true;
+            return true;
+        }
+
+    private:
+        /**
+         * Writes a sample into both copies of the delay line, so that
+         * mDelay[mIdx + k] is k samples old.
+         * 
+         * @param[in] sample Input value.
+         */
+        inline void push(const float sample) {
+            mIdx = (mIdx == 0) ? N - 1 : mIdx - 1;
+            mDelay[mIdx] = sample;
+            mDelay[mIdx + N] = sample;
+        }
+
+        /** Returns the dot product of a set of taps with the newest N samples. */
+        inline float dot(const float * h) const {
+            const float * x = mDelay + mIdx;
+            float acc[4] = {0, 0, 0, 0};
+            for (size_t k = 0; k < N / 4 * 4; k += 4) {
+                acc[0] += h[k] * x[k];
+                acc[1] += h[k + 1] * x[k + 1];
+                acc[2] += h[k + 2] * x[k + 2];
+                acc[3] += h[k + 3] * x[k + 3];
+            }
+            float sum = (acc[0] + acc[1]) + (acc[2] + acc[3]);
+            for (size_t k = N / 4 * 4; k < N; ++k) { sum += h[k] * x[k]; }
+            return sum;
+        }
+
+    private:
+        /** Filter taps. */
+        SavitzkyGolayCoefficients<N> mCoeffs;
+
+        /** Delay line, stored twice back to back. */
+        float mDelay[2 * N];
+
+        /** Index of the newest sample in the delay line. */
+        size_t mIdx;
+
+        /** Reciprocal of the time between samples. */
+        float mInvDt;
+
+        /** Cached derivative. */
+        mutable float mDerivative;
+
+        /** Whether samples were added since each output was last computed. */
+        mutable bool mDirty;
+        mutable bool mDerivativeDirty;
+};
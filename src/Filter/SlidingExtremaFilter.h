@@ -0,0 +1,210 @@
+/**
+ * Maximum Power Point Tracker Project
+ * 
+ * File: SlidingExtremaFilter.h
+ * Author: Matthew Yu
+ * Organization: UT Solar Vehicles Team
+ * Created on: October 17th, 2026
+ * Last Modified: 10/17/26
+ * 
+ * File Description: This header file implements the SlidingExtremaFilter
+ * class, which is a derived class from the parent Filter class. It tracks the
+ * minimum and maximum over a sliding window of samples, for fault detection.
+ * 
+ * Each extremum is kept in a monotonic deque stored in a RingBuffer: new
+ * samples pop every entry they dominate off the back, and entries older than
+ * the window are popped off the front. Each sample is pushed and popped at
+ * most once, so addSample is amortized O(1), and the extremum is always at the
+ * front.
+ * 
+ * Snapshots hold the sequence counter and both deques. Entries older than the
+ * window are dropped on restore, so a snapshot restored into a smaller window
+ * keeps the extrema of the newest samples.
+ * 
+ * Sources:
+ * https://people.cs.uct.ac.za/~ksmith/articles/sliding_window_minimum.html
+ */
+#pragma once
+#include "Filter.h"
+#include "FilterState.h"
+#include "../RingBuffer/RingBuffer.h"
+
+class SlidingExtremaFilter final : public Filter {
+    public:
+        /** Value reported by getResult. */
+        enum ExtremaMode {
+            MIN,
+            MAX,
+            RANGE
+        };
+
+        /** Default constructor for a SlidingExtremaFilter object. 10 sample size. */
+        SlidingExtremaFilter(void) :
+            Filter(10), mMin(10), mMax(10), mSeq(0), mMode(MAX) {}
+
+        /**
+         * Constructor for a SlidingExtremaFilter object.
+         * 
+         * @param[in] maxSamples Number of samples that the filter should 
+         *                       hold at maximum at any one time.
+         * @param[in] mode Value reported by getResult.
+         * @precondition maxSamples is a positive number.
+         */
+        SlidingExtremaFilter(const uint16_t maxSamples, const ExtremaMode mode = MAX) :
+            Filter(maxSamples), mMin(maxSamples), mMax(maxSamples), mSeq(0), mMode(mode) {}
+
+        void addSample(const float sample) override {
+            /* Check for exception. */
+            if (!mMin.valid() || !mMax.valid()) { return; }
+
+            /* Drop entries that slid out of the window. */
+            const uint32_t oldest = mSeq - mMaxSamples;
+            if (!mMin.empty() && mMin.front().seq == oldest) { mMin.consume(1); }
+            if (!mMax.empty() && mMax.front().seq == oldest) { mMax.consume(1); }
+
+            /* Drop entries the new sample dominates. */
+            while (!mMin.empty() && mMin.back().value >= sample) { mMin.popBack(); }
+            while (!mMax.empty() && mMax.back().value <= sample) { mMax.popBack(); }
+
+            mMin.push(Entry{sample, mSeq});
+            mMax.push(Entry{sample, mSeq});
+            ++mSeq;
+        }
+
+        void addSamples(const float * samples, const size_t numSamples) override {
+            for (size_t i = 0; i < numSamples; ++i) {
+                SlidingExtremaFilter::addSample(samples[i]);
+            }
+        }
+
+        void filterSamples(
+            const float * samples,
+            float * results,
+            const size_t numSamples
+        ) override {
+            for (size_t i = 0; i < numSamples; ++i) {
+                SlidingExtremaFilter::addSample(samples[i]);
+                results[i] = SlidingExtremaFilter::getResult();
+            }
+        }
+
+        /** Returns the window minimum, maximum or range, based on the mode. */
+        float getResult(void) const override {
+            switch (mMode) {
+                case MIN:
+                    return getMin();
+                case MAX:
+                    return getMax();
+                default:
+                    return getRange();
+            }
+        }
+
+        /** Returns the window minimum, or 0 if the filter is empty. */
+        float getMin(void) const {
+            /* Check for exception. */
+            if (!mMin.valid() || mMin.empty()) { return 0.0; }
+            return mMin.front().value;
+        }
+
+        /** Returns the window maximum, or 0 if the filter is empty. */
+        float getMax(void) const {
+            /* Check for exception. */
+            if (!mMax.valid() || mMax.empty()) { return 0.0; }
+            return mMax.front().value;
+        }
+
+        /** Returns the window maximum minus the window minimum. */
+        float getRange(void) const { return getMax() - getMin(); }
+
+        /**
+         * Sets the value reported by getResult.
+         * 
+         * @param[in] mode MIN, MAX or RANGE.
+         */
+        void setMode(const ExtremaMode mode) { mMode = mode; }
+
+        void clear(void) override {
+            mMin.clear();
+            mMax.clear();
+            mSeq = 0;
+        }
+
+        void shutdown(void) override {
+            mMin.release();
+            mMax.release();
+            clear();
+        }
+
+        size_t serialize(uint8_t * buffer, const size_t len) const override {
+            FilterStateWriter writer(buffer, len, FilterState::SLIDING_EXTREMA);
+            writer.put(mSeq);
+            writer.put((uint16_t) mMin.size());
+            writer.put((uint16_t) mMax.size());
+            for (size_t i = 0; i < mMin.size(); ++i) { writer.put(mMin[i]); }
+            for (size_t i = 0; i < mMax.size(); ++i) { writer.put(mMax[i]); }
+            return writer.finish();
+        }
+
+        bool deserialize(const uint8_t * buffer, const size_t len) override {
+            FilterStateReader reader(buffer, len, FilterState::SLIDING_EXTREMA);
+            uint32_t seq = 0;
+            uint16_t numMin = 0;
+            uint16_t numMax = 0;
+            reader.get(seq);
+            reader.get(numMin);
+            reader.get(numMax);
+            /* Check both deques are present before replacing them. */
+            if (!mMin.valid() || !mMax.valid() || !reader.isOk() ||
+                reader.remaining() != (size_t) (numMin + numMax) * sizeof(Entry)) {
+                return false;
+            }
+            mSeq = seq;
+            mMin.clear();
+            mMax.clear();
+            getDeque(reader, mMin, numMin);
+            getDeque(reader, mMax, numMax);
+            return true;
+        }
+
+    private:
+        /** A deque entry: a sample and its sequence number, to expire it. */
+        struct Entry {
+            float value;
+            uint32_t seq;
+        };
+
+        /**
+         * Reads a deque's entries into an empty deque, dropping those older
+         * than the window. The payload size must have been checked.
+         */
+        void getDeque(
+            FilterStateReader & reader,
+            RingBuffer<Entry, 0> & deque,
+            const uint16_t numEntries
+        ) {
+            for (uint16_t i = 0; i < numEntries; ++i) {
+                Entry entry{0, 0};
+                reader.get(entry);
+                if (mSeq - entry.seq - 1 < mMaxSamples && deque.size() < mMaxSamples) {
+                    deque.push(entry);
+                }
+            }
+        }
+
+    private:
+        /**
+         * Nondecreasing deque; its front is the window minimum. A deque never
+         * holds more entries than the window.
+         */
+        RingBuffer<Entry, 0> mMin;
+
+        /** Nonincreasing deque; its front is the window maximum. */
+        RingBuffer<Entry, 0> mMax;
+
+        /** Sequence number of the next sample. Wraps harmlessly. */
+        uint32_t mSeq;
+
+        /** Value reported by getResult. */
+        ExtremaMode mMode;
+};
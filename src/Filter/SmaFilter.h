@@ -5,27 +5,33 @@
  * Author: Matthew Yu
  * Organization: UT Solar Vehicles Team
  * Created on: September 19th, 2020
- * Last Modified: 06/08/21
+ * Last Modified: 10/17/26
  * 
  * File Description: This header file implements the SmaFilter class, which
  * is a derived class from the parent Filter class. SMA stands for Simple Moving
  * Average.
  * 
+ * The window is kept in a RingBuffer, whose capacity is the window size
+ * rounded up to a power of two; power of two windows waste no memory.
+ * 
+ * SmaFilterN is a compile time sized variant that keeps its window inside the
+ * object, so it needs no heap and can be constructed in static memory.
+ * 
+ * Snapshots hold the window samples, oldest first. Restoring replays them, so
+ * a snapshot may be restored into a filter with a different window size.
+ * 
  * Sources:
  * https://hackaday.com/2019/09/06/sensor-filters-for-coders/
  */
 #pragma once
 #include "Filter.h"
+#include "FilterState.h"
+#include "../RingBuffer/RingBuffer.h"
 
 class SmaFilter final : public Filter {
     public:
         /** Default constructor for a SmaFilter object. 10 sample size. */
-        SmaFilter(void) : Filter(10) {
-            mDataBuffer = new float[mMaxSamples];
-            mIdx = 0;
-            mNumSamples = 0;
-            mSum = 0;
-        }
+        SmaFilter(void) : Filter(10), mWindow(10), mSum(0) {}
 
         /**
          * Constructor for a SmaFilter object.
@@ -34,53 +40,242 @@ class SmaFilter final : public Filter {
          *                       hold at maximum at any one time.
          * @precondition maxSamples is a positive number.
          */
-        SmaFilter(const uint16_t maxSamples) : Filter(maxSamples) {
-            mDataBuffer = new float[mMaxSamples];
-            mIdx = 0;
-            mNumSamples = 0;
-            mSum = 0;
-        }
+        SmaFilter(const uint16_t maxSamples) :
+            Filter(maxSamples), mWindow(maxSamples), mSum(0) {}
 
-        void addSample(const float sample) override { 
+        void addSample(const float sample) override {
             /* Check for exception. */
-            if (mDataBuffer == nullptr) { return; }
+            if (!mWindow.valid()) { return; }
             
-            /* Saturate counter at max samples. */
-            if (mNumSamples < mMaxSamples) {
-                ++mNumSamples;
+            /* Saturate the window at max samples. */
+            if (mWindow.size() < mMaxSamples) {
                 mSum += sample;
             } else {
-                /* Add the new value but remove the value at the 
-                   current index we're overwriting. */
-                mSum += sample - mDataBuffer[mIdx];
+                /* Add the new value but remove the oldest one. */
+                mSum += sample - mWindow.front();
+                mWindow.consume(1);
             }
-            mDataBuffer[mIdx] = sample;
-            mIdx = (mIdx + 1) % mMaxSamples;
+            mWindow.push(sample);
         }
 
-        float getResult(void) const override { 
+        void addSamples(const float * samples, const size_t numSamples) override {
             /* Check for exception. */
-            if (mDataBuffer == nullptr || mNumSamples == 0) { return 0.0; }
-            return mSum / mNumSamples;
+            if (!mWindow.valid()) { return; }
+
+            size_t i = 0;
+            /* While the window is filling, nothing leaves the sum. */
+            for (; i < numSamples && mWindow.size() < mMaxSamples; ++i) {
+                mSum += samples[i];
+                mWindow.push(samples[i]);
+            }
+
+            /* Once full, walk the oldest samples and the slots the new ones
+               land in as contiguous runs up to the wrap point. Each run is a
+               plain elementwise loop with no index math. */
+            const size_t capacity = mWindow.capacity();
+            float sum = mSum;
+            while (i < numSamples) {
+                const size_t oldSlot = mWindow.slotOf(0);
+                const size_t newSlot = mWindow.slotOf(mMaxSamples);
+                size_t run = numSamples - i;
+                if (run > capacity - oldSlot) { run = capacity - oldSlot; }
+                if (run > capacity - newSlot) { run = capacity - newSlot; }
+
+                const float * in = samples + i;
+                const float * oldest = &mWindow.atSlot(oldSlot);
+                float * ring = &mWindow.atSlot(newSlot);
+                float delta = 0;
+                for (size_t j = 0; j < run; ++j) {
+                    delta += in[j] - oldest[j];
+                    ring[j] = in[j];
+                }
+                sum += delta;
+                mWindow.consume(run);
+                mWindow.commit(run);
+
+                i += run;
+            }
+            mSum = sum;
+        }
+
+        void filterSamples(
+            const float * samples,
+            float * results,
+            const size_t numSamples
+        ) override {
+            /* Check for exception. */
+            if (!mWindow.valid()) { return; }
+
+            for (size_t i = 0; i < numSamples; ++i) {
+                SmaFilter::addSample(samples[i]);
+                results[i] = mSum / mWindow.size();
+            }
+        }
+
+        float getResult(void) const override {
+            if (mWindow.empty()) { return 0.0; }
+            return mSum / mWindow.size();
         }
 
         void clear(void) override {
-            mNumSamples = 0;
-            mIdx = 0;
+            mWindow.clear();
             mSum = 0;
         }
 
-        void shutdown(void) override { delete[] mDataBuffer; }
+        size_t serialize(uint8_t * buffer, const size_t len) const override {
+            FilterStateWriter writer(buffer, len, FilterState::SMA);
+            const uint16_t numSamples = mWindow.size();
+            writer.put(numSamples);
+            for (uint16_t i = 0; i < numSamples; ++i) {
+                writer.put(mWindow[i]);
+            }
+            return writer.finish();
+        }
+
+        bool deserialize(const uint8_t * buffer, const size_t len) override {
+            FilterStateReader reader(buffer, len, FilterState::SMA);
+            uint16_t numSamples = 0;
+            reader.get(numSamples);
+            if (!mWindow.valid() || !reader.isOk() ||
+                reader.remaining() != numSamples * sizeof(float)) {
+                return false;
+            }
+            clear();
+            for (uint16_t i = 0; i < numSamples; ++i) {
+                float sample = 0;
+                reader.get(sample);
+                SmaFilter::addSample(sample);
+            }
+            return true;
+        }
+
+        void shutdown(void) override {
+            mWindow.release();
+            clear();
+        }
 
     private:
-        /** Data Buffer. */
-        float * mDataBuffer;
+        /** Window of samples, oldest first. */
+        RingBuffer<float, 0> mWindow;
+
+        /** Sum of the current window of data points. */
+        float mSum;
+};
+
+/**
+ * Compile time sized SmaFilter.
+ * 
+ * @tparam N Number of samples that the filter should hold at maximum at any
+ *           one time. Must be positive.
+ */
+template <uint16_t N>
+class SmaFilterN final : public Filter {
+    static_assert(N > 0, "SmaFilterN requires a positive window size.");
+
+    public:
+        /** Constructor for a SmaFilterN object. */
+        constexpr SmaFilterN(void) : Filter(N), mWindow(), mSum(0) {}
 
-        /** Number of samples in the buffer. */
-        uint16_t mNumSamples;
+        void addSample(const float sample) override {
+            /* Saturate the window at max samples. */
+            if (mWindow.size() < N) {
+                mSum += sample;
+            } else {
+                /* Add the new value but remove the oldest one. */
+                mSum += sample - mWindow.front();
+                mWindow.consume(1);
+            }
+            mWindow.push(sample);
+        }
 
-        /** Current index in the buffer. */
-        uint16_t mIdx;
+        void addSamples(const float * samples, const size_t numSamples) override {
+            size_t i = 0;
+            /* While the window is filling, nothing leaves the sum. */
+            for (; i < numSamples && mWindow.size() < N; ++i) {
+                mSum += samples[i];
+                mWindow.push(samples[i]);
+            }
+
+            /* Once full, walk the oldest samples and the slots the new ones
+               land in as contiguous runs up to the wrap point. Each run is a
+               plain elementwise loop with no index math. */
+            const size_t capacity = mWindow.capacity();
+            float sum = mSum;
+            while (i < numSamples) {
+                const size_t oldSlot = mWindow.slotOf(0);
+                const size_t newSlot = mWindow.slotOf(N);
+                size_t run = numSamples - i;
+                if (run > capacity - oldSlot) { run = capacity - oldSlot; }
+                if (run > capacity - newSlot) { run = capacity - newSlot; }
+
+                const float * in = samples + i;
+                const float * oldest = &mWindow.atSlot(oldSlot);
+                float * ring = &mWindow.atSlot(newSlot);
+                float delta = 0;
+                for (size_t j = 0; j < run; ++j) {
+                    delta += in[j] - oldest[j];
+                    ring[j] = in[j];
+                }
+                sum += delta;
+                mWindow.consume(run);
+                mWindow.commit(run);
+
+                i += run;
+            }
+            mSum = sum;
+        }
+
+        void filterSamples(
+            const float * samples,
+            float * results,
+            const size_t numSamples
+        ) override {
+            for (size_t i = 0; i < numSamples; ++i) {
+                SmaFilterN::addSample(samples[i]);
+                results[i] = mSum / mWindow.size();
+            }
+        }
+
+        float getResult(void) const override {
+            if (mWindow.empty()) { return 0.0; }
+            return mSum / mWindow.size();
+        }
+
+        void clear(void) override {
+            mWindow.clear();
+            mSum = 0;
+        }
+
+        size_t serialize(uint8_t * buffer, const size_t len) const override {
+            FilterStateWriter writer(buffer, len, FilterState::SMA);
+            const uint16_t numSamples = mWindow.size();
+            writer.put(numSamples);
+            for (uint16_t i = 0; i < numSamples; ++i) {
+                writer.put(mWindow[i]);
+            }
+            return writer.finish();
+        }
+
+        bool deserialize(const uint8_t * buffer, const size_t len) override {
+            FilterStateReader reader(buffer, len, FilterState::SMA);
+            uint16_t numSamples = 0;
+            reader.get(numSamples);
+            if (!reader.isOk() ||
+                reader.remaining() != numSamples * sizeof(float)) {
+                return false;
+            }
+            clear();
+            for (uint16_t i = 0; i < numSamples; ++i) {
+                float sample = 0;
+                reader.get(sample);
+                SmaFilterN::addSample(sample);
+            }
+            return true;
+        }
+
+    private:
+        /** Window of samples, oldest first. */
+        RingBuffer<float, ringCapacity(N)> mWindow;
 
         /** Sum of the current window of data points. */
         float mSum;
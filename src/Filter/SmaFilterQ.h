@@ -0,0 +1,101 @@
+/**
+ * Maximum Power Point Tracker Project
+ * 
+ * File: SmaFilterQ.h
+ * Author: Matthew Yu
+ * Organization: UT Solar Vehicles Team
+ * Created on: October 17th, 2026
+ * Last Modified: 10/17/26
+ * 
+ * File Description: This header file implements the SmaFilterQ class, a fixed
+ * point Simple Moving Average over raw integer sample codes. It mirrors
+ * SmaFilterN but never touches floating point. See FixedPoint.h.
+ */
+#pragma once
+#include "FixedPoint.h"
+#include <stddef.h>
+#include <array>
+
+/**
+ * @tparam Q Q15 or Q31. Selects the sample and accumulator widths.
+ * @tparam N Number of samples that the filter should hold at maximum at any
+ *           one time. Must be positive.
+ */
+template <typename Q, uint16_t N>
+class SmaFilterQ final {
+    static_assert(N > 0, "SmaFilterQ requires a positive window size.");
+
+    public:
+        typedef typename Q::Sample Sample;
+        typedef typename Q::Accum Accum;
+
+    public:
+        /** Constructor for a SmaFilterQ object. */
+        constexpr SmaFilterQ(void) :
+            mDataBuffer{}, mNumSamples(0), mIdx(0), mSum(0) {}
+
+        /**
+         * Adds a sample to the filter and updates calculations.
+         * 
+         * @param[in] sample Raw sample code.
+         */
+        void addSample(const Sample sample) {
+            /* Saturate counter at max samples. */
+            if (mNumSamples < N) {
+                ++mNumSamples;
+                mSum += sample;
+            } else {
+                mSum += (Accum) sample - mDataBuffer[mIdx];
+            }
+            mDataBuffer[mIdx] = sample;
+            if ((N & (N - 1)) == 0) {
+                mIdx = (mIdx + 1) & (N - 1);
+            } else if (++mIdx == N) {
+                mIdx = 0;
+            }
+        }
+
+        /**
+         * Adds a block of samples to the filter in order.
+         * 
+         * @param[in] samples Pointer to the raw sample codes.
+         * @param[in] numSamples Number of samples.
+         */
+        void addSamples(const Sample * samples, const size_t numSamples) {
+            for (size_t i = 0; i < numSamples; ++i) { addSample(samples[i]); }
+        }
+
+        /**
+         * Returns the filtered result of the input data.
+         * 
+         * @return Window mean, rounded to the nearest code.
+         */
+        Sample getResult(void) const {
+            if (mNumSamples == 0) { return 0; }
+            /* A full window divides by a constant, which compiles down to a
+               multiply or a shift. */
+            const Accum count = (mNumSamples == N) ? (Accum) N : (Accum) mNumSamples;
+            const Accum half = (mSum >= 0) ? count / 2 : -(count / 2);
+            return (Sample) ((mSum + half) / count);
+        }
+
+        /** Clears data stored in the filter. */
+        void clear(void) {
+            mNumSamples = 0;
+            mIdx = 0;
+            mSum = 0;
+        }
+
+    private:
+        /** Data Buffer. */
+        std::array<Sample, N> mDataBuffer;
+
+        /** Number of samples in the buffer. */
+        uint16_t mNumSamples;
+
+        /** Current index in the buffer. */
+        uint16_t mIdx;
+
+        /** Sum of the current window of data points. Cannot overflow. */
+        Accum mSum;
+};
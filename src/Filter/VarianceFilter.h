@@ -0,0 +1,378 @@
+/**
+ * Maximum Power Point Tracker Project
+ * 
+ * File: VarianceFilter.h
+ * Author: Matthew Yu
+ * Organization: UT Solar Vehicles Team
+ * Created on: October 17th, 2026
+ * Last Modified: 10/17/26
+ * 
+ * File Description: This header file implements the VarianceFilter and
+ * EmaVarianceFilter classes, which are derived classes from the parent Filter
+ * class. They track the mean, variance and standard deviation of a sensor
+ * channel, so noise can be measured online (i.e. to feed a KalmanFilter's
+ * measurement uncertainty) instead of offline.
+ * 
+ * VarianceFilter works over a sliding window kept in a RingBuffer, using
+ * Welford's update extended to remove the sample leaving the window. Rounding
+ * errors of the sliding update accumulate without bound (i.e. a 64 sample
+ * window at 85 V reads a variance 100x too high after an hour at 1 kHz), so
+ * once per window's worth of samples the mean and M2 are recomputed from the
+ * window with two passes. This costs two extra operations per sample on
+ * average and keeps everything in float. EmaVarianceFilter weights samples
+ * exponentially, like EmaFilter. Both report the population variance.
+ * Snapshots of a VarianceFilter hold the running mean and M2 along with the
+ * window, oldest sample first.
+ * 
+ * Sources:
+ * https://en.wikipedia.org/wiki/Algorithms_for_calculating_variance#Welford's_online_algorithm
+ * https://fanf2.user.srcf.net/hermes/doc/antiforgery/stats.pdf
+ */
+#pragma once
+#include "Filter.h"
+#include "FilterState.h"
+#include "../RingBuffer/RingBuffer.h"
+#include <cmath>
+
+class VarianceFilter final : public Filter {
+    public:
+        /** Value reported by getResult. */
+        enum StatMode {
+            MEAN,
+            VARIANCE,
+            STDDEV
+        };
+
+        /** Default constructor for a VarianceFilter object. 10 sample size. */
+        VarianceFilter(void) : Filter(10), mWindow(10) { init(VARIANCE); }
+
+        /**
+         * Constructor for a VarianceFilter object.
+         * 
+         * @param[in] maxSamples Number of samples that the filter should 
+         *                       hold at maximum at any one time.
+         * @param[in] mode Value reported by getResult.
+         * @precondition maxSamples is a positive number.
+         */
+        VarianceFilter(const uint16_t maxSamples, const StatMode mode = VARIANCE) :
+            Filter(maxSamples), mWindow(maxSamples) { init(mode); }
+
+        void addSample(const float sample) override {
+            /* Check for exception. */
+            if (!mWindow.valid()) { return; }
+
+            if (mWindow.size() < mMaxSamples) {
+                /* Welford's update while the window is filling. */
+                const float delta = sample - mMean;
+                mMean += delta / (mWindow.size() + 1);
+                mM2 += delta * (sample - mMean);
+            } else {
+                /* Replace the oldest sample in one step. */
+                const float old = mWindow.front();
+                const float oldMean = mMean;
+                mMean += (sample - old) * mInvMaxSamples;
+                mM2 += (sample - old) * (sample - mMean + old - oldMean);
+                mWindow.consume(1);
+            }
+            mWindow.push(sample);
+
+            if (++mNumUpdates == mMaxSamples) { reanchor(); }
+        }
+
+        void addSamples(const float * samples, const size_t numSamples) override {
+            for (size_t i = 0; i < numSamples; ++i) {
+                VarianceFilter::addSample(samples[i]);
+            }
+        }
+
+        void filterSamples(
+            const float * samples,
+            float * results,
+            const size_t numSamples
+        ) override {
+            for (size_t i = 0; i < numSamples; ++i) {
+                VarianceFilter::addSample(samples[i]);
+                results[i] = VarianceFilter::getResult();
+            }
+        }
+
+        /** Returns the window mean, variance or standard deviation. */
+        float getResult(void) const override {
+            switch (mMode) {
+                case MEAN:
+                    return getMean();
+                case STDDEV:
+                    return getStdDev();
+                default:
+                    return getVariance();
+            }
+        }
+
+        /** Returns the window mean. */
+        float getMean(void) const { return mMean; }
+
+        /** Returns the window population variance. */
+        float getVariance(void) const {
+            if (mWindow.empty()) { return 0.0; }
+            /* Rounding can push M2 slightly below zero. */
+            const float variance = mM2 / mWindow.size();
+            return (variance > 0) ? variance : 0.0f;
+        }
+
+        /** Returns the window population standard deviation. */
+        float getStdDev(void) const { return sqrtf(getVariance()); }
+
+        /**
+         * Sets the value reported by getResult.
+         * 
+         * @param[in] mode MEAN, VARIANCE or STDDEV.
+         */
+        void setMode(const StatMode mode) { mMode = mode; }
+
+        void clear(void) override {
+            mWindow.clear();
+            mMean = 0;
+            mM2 = 0;
+            mNumUpdates = 0;
+        }
+
+        void shutdown(void) override {
+            mWindow.release();
+            clear();
+        }
+
+        size_t serialize(uint8_t * buffer, const size_t len) const override {
+            FilterStateWriter writer(buffer, len, FilterState::VARIANCE);
+            writer.put(mMean);
+            writer.put(mM2);
+            writer.put((uint16_t) mWindow.size());
+            for (size_t i = 0; i < mWindow.size(); ++i) { writer.put(mWindow[i]); }
+            return writer.finish();
+        }
+
+        bool deserialize(const uint8_t * buffer, const size_t len) override {
+            FilterStateReader reader(buffer, len, FilterState::VARIANCE);
+            float mean = 0;
+            float m2 = 0;
+            uint16_t numSamples = 0;
+            reader.get(mean);
+            reader.get(m2);
+            reader.get(numSamples);
+            /* Check the window fits before replacing it. */
+            if (!mWindow.valid() || !reader.isOk() || numSamples > mMaxSamples ||
+                reader.remaining() != numSamples * sizeof(float)) {
+                return false;
+            }
+            mWindow.clear();
+            for (uint16_t i = 0; i < numSamples; ++i) {
+                float sample = 0;
+                reader.get(sample);
+                mWindow.push(sample);
+            }
+            mMean = mean;
+            mM2 = m2;
+            mNumUpdates = 0;
+            return true;
+        }
+
+    private:
+        void init(const StatMode mode) {
+            mInvMaxSamples = 1.0f / mMaxSamples;
+            mMode = mode;
+            clear();
+        }
+
+        /**
+         * Recomputes the mean and M2 from the window with two passes, dropping
+         * the rounding error the sliding updates accumulated.
+         */
+        void reanchor(void) {
+            RingSpan<float> spans[2];
+            mWindow.readSpans(spans[0], spans[1]);
+
+            /* Sum offsets from the oldest sample, so a large DC level does not
+               swamp the digits of the noise. */
+            const float origin = spans[0].data[0];
+            float sum = 0;
+            for (size_t s = 0; s < 2; ++s) {
+                for (size_t i = 0; i < spans[s].size; ++i) {
+                    sum += spans[s].data[i] - origin;
+                }
+            }
+            const float mean = origin + sum / mWindow.size();
+
+            float m2 = 0;
+            for (size_t s = 0; s < 2; ++s) {
+                for (size_t i = 0; i < spans[s].size; ++i) {
+                    const float delta = spans[s].data[i] - mean;
+                    m2 += delta * delta;
+                }
+            }
+            mMean = mean;
+            mM2 = m2;
+            mNumUpdates = 0;
+        }
+
+    private:
+        /** Window of samples, oldest first. */
+        RingBuffer<float, 0> mWindow;
+
+        /** Mean of the current window. */
+        float mMean;
+
+        /** Sum of squared differences from the mean over the current window. */
+        float mM2;
+
+        /** Number of samples added since the mean and M2 were recomputed. */
+        uint16_t mNumUpdates;
+
+        /** Reciprocal of the window size. */
+        float mInvMaxSamples;
+
+        /** Value reported by getResult. */
+        StatMode mMode;
+};
+
+class EmaVarianceFilter final : public Filter {
+    public:
+        /** Value reported by getResult. */
+        enum StatMode {
+            MEAN,
+            VARIANCE,
+            STDDEV
+        };
+
+        /** Default constructor for a EmaVarianceFilter object. Alpha of 0.2. */
+        EmaVarianceFilter(void) : Filter(10) {
+            mAlpha = 0.2;
+            mMode = VARIANCE;
+            clear();
+        }
+
+        /**
+         * Constructor for a EmaVarianceFilter object.
+         * 
+         * @param[in] alpha A constant from [0, 1] inclusive that indicates the
+         *                  weight decline of each progressive sample.
+         * @param[in] mode Value reported by getResult.
+         */
+        EmaVarianceFilter(const float alpha, const StatMode mode = VARIANCE) : Filter(10) {
+            mAlpha = alpha;
+            mMode = mode;
+            clear();
+        }
+
+        void addSample(const float sample) override {
+            update(sample, mMean, mVariance);
+        }
+
+        void addSamples(const float * samples, const size_t numSamples) override {
+            /* Keep the state in locals so it stays in registers. */
+            float mean = mMean;
+            float variance = mVariance;
+            for (size_t i = 0; i < numSamples; ++i) {
+                update(samples[i], mean, variance);
+            }
+            mMean = mean;
+            mVariance = variance;
+        }
+
+        void filterSamples(
+            const float * samples,
+            float * results,
+            const size_t numSamples
+        ) override {
+            for (size_t i = 0; i < numSamples; ++i) {
+                update(samples[i], mMean, mVariance);
+                results[i] = EmaVarianceFilter::getResult();
+            }
+        }
+
+        /** Returns the weighted mean, variance or standard deviation. */
+        float getResult(void) const override {
+            switch (mMode) {
+                case MEAN:
+                    return mMean;
+                case STDDEV:
+                    return getStdDev();
+                default:
+                    return mVariance;
+            }
+        }
+
+        /** Returns the exponentially weighted mean. */
+        float getMean(void) const { return mMean; }
+
+        /** Returns the exponentially weighted variance. */
+        float getVariance(void) const { return mVariance; }
+
+        /** Returns the exponentially weighted standard deviation. */
+        float getStdDev(void) const { return sqrtf(mVariance); }
+
+        /**
+         * Sets the value reported by getResult.
+         * 
+         * @param[in] mode MEAN, VARIANCE or STDDEV.
+         */
+        void setMode(const StatMode mode) { mMode = mode; }
+
+        /** Resets the mean and variance. The first sample seeds the mean. */
+        void clear(void) override {
+            mMean = 0;
+            mVariance = 0;
+            mSeeded = false;
+        }
+
+        size_t serialize(uint8_t * buffer, const size_t len) const override {
+            FilterStateWriter writer(buffer, len, FilterState::EMA_VARIANCE);
+            writer.put(mMean);
+            writer.put(mVariance);
+            writer.put(mSeeded);
+            return writer.finish();
+        }
+
+        bool deserialize(const uint8_t * buffer, const size_t len) override {
+            FilterStateReader reader(buffer, len, FilterState::EMA_VARIANCE);
+            float mean = 0;
+            float variance = 0;
+            bool seeded = false;
+            reader.get(mean);
+            reader.get(variance);
+            reader.get(seeded);
+            if (!reader.isValid()) { return false; }
+            mMean = mean;
+            mVariance = variance;
+            mSeeded = seeded;
+            return true;
+        }
+
+    private:
+        /** Runs a single weighted mean and variance update. */
+        inline void update(const float sample, float & mean, float & variance) {
+            if (!mSeeded) {
+                mean = sample;
+                mSeeded = true;
+                return;
+            }
+            const float delta = sample - mean;
+            const float incr = mAlpha * delta;
+            mean += incr;
+            variance = (1 - mAlpha) * (variance + delta * incr);
+        }
+
+    private:
+        /** Exponentially weighted mean. */
+        float mMean;
+
+        /** Exponentially weighted variance. */
+        float mVariance;
+
+        /** Weight of each new sample. */
+        float mAlpha;
+
+        /** Whether the mean has been seeded by a first sample. */
+        bool mSeeded;
+
+        /** Value reported by getResult. */
+        StatMode mMode;
+};
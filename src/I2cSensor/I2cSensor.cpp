@@ -5,7 +5,7 @@
  * Author: Matthew Yu
  * Organization: UT Solar Vehicles Team
  * Created on: June 6th, 2021
- * Last Modified: 06/06/21
+ * Last Modified: 10/17/26
  * 
  * File Description: Describes the I2cSensor class, which is a derivative of the
  * Sensor class. It utilizes I2C.
@@ -16,7 +16,4 @@ I2cSensor::I2cSensor(
     const PinName sda, 
     const PinName scl) : mI2cSensor(sda, scl) {}
 
-void I2cSensor::clearHistory(void) {
-    mFilter->clear();
-    mSensorValue = 0;
-}
+void I2cSensor::clearHistory(void) { resetFilter(); }
@@ -0,0 +1,290 @@
+/**
+ * Maximum Power Point Tracker Project
+ * 
+ * File: RingBuffer.h
+ * Author: Matthew Yu
+ * Organization: UT Solar Vehicles Team
+ * Created on: October 17th, 2026
+ * Last Modified: 10/17/26
+ * 
+ * File Description: This header file implements the RingBuffer class, a FIFO
+ * circular buffer shared by the windowed filters and the communication
+ * devices. The capacity is a power of two, so indices wrap with a mask instead
+ * of a divide. The read and write positions are free running counters; their
+ * difference is the number of stored items, so every slot is usable.
+ * 
+ * The stored items, and the free space, are each at most two contiguous runs,
+ * split where the buffer wraps. readSpans and writeSpans expose these runs so
+ * callers can process or fill them with plain loops, then consume or commit
+ * the number of items handled.
+ * 
+ * The template parameter N selects the storage. N > 0 stores N items inside
+ * the object; N == 0 allocates a buffer of runtime size on the heap, rounded
+ * up to a power of two, which must be released with release().
+ */
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Returns the smallest power of two that is at least n, i.e. the capacity of
+ * a RingBuffer able to hold n items.
+ * 
+ * @param[in] n Number of items.
+ * @return Power of two capacity.
+ */
+constexpr size_t ringCapacity(const size_t n) {
+    size_t capacity = 1;
+    while (capacity < n) { capacity <<= 1; }
+    return capacity;
+}
+
+/** A contiguous run of items in a RingBuffer. */
+template <typename T>
+struct RingSpan {
+    T * data;
+    size_t size;
+};
+
+/** In-object storage for N items. */
+template <typename T, size_t N>
+struct RingStorage {
+    constexpr RingStorage(const size_t) : data{} {}
+    constexpr bool valid(void) const { return true; }
+    static constexpr size_t mask(void) { return N - 1; }
+    void release(void) {}
+
+    T data[N];
+};
+
+/** Heap allocated storage for a buffer sized at runtime. */
+template <typename T>
+struct RingStorage<T, 0> {
+    RingStorage(const size_t capacity) :
+        data(new T[ringCapacity(capacity)]),
+        size(ringCapacity(capacity)) {}
+    bool valid(void) const { return data != nullptr; }
+    size_t mask(void) const { return size - 1; }
+    void release(void) {
+        delete[] data;
+        data = nullptr;
+    }
+
+    T * data;
+    size_t size;
+};
+
+/**
+ * @tparam T Item type. Must be default constructible and copyable.
+ * @tparam N Capacity. Must be a power of two, or 0 to size the buffer at
+ *           runtime.
+ */
+template <typename T, size_t N>
+class RingBuffer {
+    static_assert((N & (N - 1)) == 0, "RingBuffer capacity must be a power of two.");
+
+    public:
+        /**
+         * Constructor for a RingBuffer object.
+         * 
+         * @param[in] capacity Minimum number of items to hold. Ignored if
+         *                     N > 0.
+         * @precondition The capacity is a positive number.
+         */
+        constexpr RingBuffer(const size_t capacity = N) :
+            mStore(capacity), mHead(0), mTail(0) {}
+
+        /** Returns whether the storage was allocated. */
+        bool valid(void) const { return mStore.valid(); }
+
+        /** Returns the number of items the buffer can hold. */
+        size_t capacity(void) const { return mStore.mask() + 1; }
+
+        /** Returns the number of stored items. */
+        size_t size(void) const { return (uint32_t) (mHead - mTail); }
+
+        bool empty(void) const { return mHead == mTail; }
+
+        bool full(void) const { return size() == capacity(); }
+
+        /**
+         * Appends an item.
+         * 
+         * @param[in] item Item to append.
+         * @return Whether there was room for the item.
+         */
+        bool push(const T & item) {
+            if (!valid() || full()) { return false; }
+            mStore.data[mHead & mStore.mask()] = item;
+            ++mHead;
+            return true;
+        }
+
+        /**
+         * Appends as many of a run of items as fit.
+         * 
+         * @param[in] items Pointer to the items to append.
+         * @param[in] numItems Number of items to append.
+         * @return Number of items appended.
+         */
+        size_t push(const T * items, const size_t numItems) {
+            if (!valid()) { return 0; }
+            RingSpan<T> spans[2];
+            writeSpans(spans[0], spans[1]);
+            size_t count = 0;
+            for (size_t s = 0; s < 2; ++s) {
+                size_t run = spans[s].size;
+                if (run > numItems - count) { run = numItems - count; }
+                for (size_t i = 0; i < run; ++i) { spans[s].data[i] = items[count + i]; }
+                count += run;
+            }
+            commit(count);
+            return count;
+        }
+
+        /**
+         * Removes the oldest item.
+         * 
+         * @param[out] item Removed item.
+         * @return Whether there was an item to remove.
+         */
+        bool pop(T & item) {
+            if (!valid() || empty()) { return false; }
+            item = mStore.data[mTail & mStore.mask()];
+            ++mTail;
+            return true;
+        }
+
+        /**
+         * Removes up to a number of the oldest items.
+         * 
+         * @param[out] items Pointer to an array to fill, oldest first.
+         * @param[in] numItems Maximum number of items to remove.
+         * @return Number of items removed.
+         */
+        size_t pop(T * items, const size_t numItems) {
+            if (!valid()) { return 0; }
+            RingSpan<T> spans[2];
+            readSpans(spans[0], spans[1]);
+            size_t count = 0;
+            for (size_t s = 0; s < 2; ++s) {
+                size_t run = spans[s].size;
+                if (run > numItems - count) { run = numItems - count; }
+                for (size_t i = 0; i < run; ++i) { items[count + i] = spans[s].data[i]; }
+                count += run;
+            }
+            consume(count);
+            return count;
+        }
+
+        /**
+         * Removes the newest item, so the buffer can serve as a deque (i.e.
+         * the monotonic deques of SlidingExtremaFilter).
+         * 
+         * @precondition The buffer is not empty.
+         */
+        void popBack(void) { --mHead; }
+
+        /**
+         * Returns a stored item by age.
+         * 
+         * @param[in] i Position in the buffer, 0 being the oldest item.
+         * @precondition i is less than size().
+         */
+        T & operator[](const size_t i) { return mStore.data[slotOf(i)]; }
+        const T & operator[](const size_t i) const { return mStore.data[slotOf(i)]; }
+
+        /** Returns the oldest item. @precondition The buffer is not empty. */
+        T & front(void) { return mStore.data[mTail & mStore.mask()]; }
+        const T & front(void) const { return mStore.data[mTail & mStore.mask()]; }
+
+        /** Returns the newest item. @precondition The buffer is not empty. */
+        T & back(void) { return mStore.data[(mHead - 1) & mStore.mask()]; }
+        const T & back(void) const { return mStore.data[(mHead - 1) & mStore.mask()]; }
+
+        /**
+         * Returns the storage slot of a stored item, for callers that index
+         * side tables by slot.
+         * 
+         * @param[in] i Position in the buffer, 0 being the oldest item.
+         * @return Index into the storage, less than capacity().
+         */
+        size_t slotOf(const size_t i) const { return (mTail + i) & mStore.mask(); }
+
+        /** Returns the item in a storage slot. */
+        T & atSlot(const size_t slot) { return mStore.data[slot]; }
+        const T & atSlot(const size_t slot) const { return mStore.data[slot]; }
+
+        /**
+         * Returns the stored items as up to two contiguous runs, oldest first.
+         * 
+         * @param[out] first Run starting at the oldest item.
+         * @param[out] second Run continuing from the start of the storage, or
+         *                    empty if the items do not wrap.
+         */
+        void readSpans(RingSpan<T> & first, RingSpan<T> & second) {
+            spans(mTail, size(), first, second);
+        }
+
+        /**
+         * Returns the free space as up to two contiguous runs, in the order
+         * they will be filled. Fill them and commit() the number written.
+         * 
+         * @param[out] first Run starting after the newest item.
+         * @param[out] second Run continuing from the start of the storage, or
+         *                    empty if the free space does not wrap.
+         */
+        void writeSpans(RingSpan<T> & first, RingSpan<T> & second) {
+            spans(mHead, capacity() - size(), first, second);
+        }
+
+        /**
+         * Removes the oldest items without copying them out.
+         * 
+         * @param[in] numItems Number of items to remove.
+         * @precondition numItems is at most size().
+         */
+        void consume(const size_t numItems) { mTail += numItems; }
+
+        /**
+         * Appends items written directly into the free space.
+         * 
+         * @param[in] numItems Number of items written.
+         * @precondition numItems is at most capacity() - size().
+         */
+        void commit(const size_t numItems) { mHead += numItems; }
+
+        /** Empties the buffer. */
+        void clear(void) {
+            mHead = 0;
+            mTail = 0;
+        }
+
+        /** Releases heap allocated storage, if any. */
+        void release(void) { mStore.release(); }
+
+    private:
+        /** Splits numItems items starting at counter position start at the wrap. */
+        void spans(
+            const uint32_t start,
+            const size_t numItems,
+            RingSpan<T> & first,
+            RingSpan<T> & second
+        ) {
+            const size_t slot = start & mStore.mask();
+            size_t run = capacity() - slot;
+            if (run > numItems) { run = numItems; }
+            first.data = mStore.data + slot;
+            first.size = run;
+            second.data = mStore.data;
+            second.size = numItems - run;
+        }
+
+    private:
+        /** Item storage. */
+        RingStorage<T, N> mStore;
+
+        /** Free running write and read counters. */
+        uint32_t mHead;
+        uint32_t mTail;
+};
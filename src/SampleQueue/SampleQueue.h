@@ -0,0 +1,172 @@
+/**
+ * Maximum Power Point Tracker Project
+ * 
+ * File: SampleQueue.h
+ * Author: Matthew Yu
+ * Organization: UT Solar Vehicles Team
+ * Created on: October 17th, 2026
+ * Last Modified: 10/17/26
+ * 
+ * File Description: This header file implements the SampleQueue class, a
+ * lock-free single producer, single consumer queue. It hands samples from an
+ * interrupt handler (the producer) to the thread that filters them (the
+ * consumer) without either side waiting on, or being turned away by, a lock.
+ * 
+ * Like RingBuffer, the capacity is a power of two and the read and write
+ * positions are free running counters. The producer alone advances the write
+ * counter and the consumer alone advances the read counter, so each side only
+ * loads the other's counter (acquire) and stores its own (release). No read-
+ * modify-write atomics are used, so the queue is lock-free even on cores
+ * without exclusive access instructions, such as the Cortex-M0+.
+ * 
+ * When the queue is full, push overwrites the oldest item, so the consumer
+ * always gets the newest samples. The producer never waits for the consumer,
+ * so a pop may race with a push into the slot it is reading. Before each
+ * slot write the producer publishes the counter it is writing, and after
+ * copying the consumer rereads it, like a sequence lock, and discards any
+ * copies that may have been overwritten. Overwritten items are counted as
+ * dropped when the consumer notices them.
+ */
+#pragma once
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @tparam T Item type. Must be trivially copyable and small enough for
+ *           std::atomic<T> to be lock-free, i.e. float or uint32_t.
+ * @tparam N Capacity. Must be a positive power of two.
+ */
+template <typename T, size_t N>
+class SampleQueue {
+    static_assert(N > 0 && (N & (N - 1)) == 0, "SampleQueue capacity must be a power of two.");
+
+    public:
+        /** Constructor for a SampleQueue object. */
+        SampleQueue(void) : mHead(0), mWriting(0), mTail(0), mDropped(0) {
+            for (size_t i = 0; i < N; ++i) { mData[i].store(T(), std::memory_order_relaxed); }
+        }
+
+        SampleQueue(const SampleQueue &) = delete;
+        SampleQueue & operator=(const SampleQueue &) = delete;
+
+        /** Returns the number of items the queue can hold. */
+        static constexpr size_t capacity(void) { return N; }
+
+        /**
+         * Appends an item, overwriting the oldest one if the queue is full.
+         * Producer only; safe to call from an interrupt.
+         * 
+         * @param[in] item Item to append.
+         * @return Whether there was room for the item without overwriting an
+         *         unread one.
+         */
+        bool push(const T & item) {
+            const uint32_t head = mHead.load(std::memory_order_relaxed);
+            /* Announce the slot before touching it, so a consumer copying it
+               can tell its copy may be torn. */
+            mWriting.store(head + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            mData[head & (N - 1)].store(item, std::memory_order_relaxed);
+            mHead.store(head + 1, std::memory_order_release);
+            return head - mTail.load(std::memory_order_acquire) < N;
+        }
+
+        /**
+         * Removes the oldest items. Consumer only.
+         * 
+         * @param[out] items Removed items, oldest first.
+         * @param[in] maxItems Maximum number of items to remove.
+         * @return Number of items removed.
+         */
+        size_t pop(T * items, const size_t maxItems) {
+            uint32_t tail = mTail.load(std::memory_order_relaxed);
+            while (true) {
+                const uint32_t head = mHead.load(std::memory_order_acquire);
+                /* Skip items the producer has already overwritten. */
+                if (head - tail > N) {
+                    addDropped(head - N - tail);
+                    tail = head - N;
+                }
+                size_t numItems = head - tail;
+                if (numItems > maxItems) { numItems = maxItems; }
+                if (numItems == 0) { break; }
+
+                for (size_t i = 0; i < numItems; ++i) {
+                    items[i] = mData[(tail + i) & (N - 1)].load(std::memory_order_relaxed);
+                }
+
+                /* Copies of items more than N behind the slot being written
+                   may hold newer data; drop them. */
+                std::atomic_thread_fence(std::memory_order_acquire);
+                const uint32_t lapped = mWriting.load(std::memory_order_relaxed) - tail;
+                size_t numStale = (lapped > N) ? lapped - N : 0;
+                if (numStale > numItems) { numStale = numItems; }
+                if (numStale > 0) {
+                    addDropped(numStale);
+                    for (size_t i = numStale; i < numItems; ++i) {
+                        items[i - numStale] = items[i];
+                    }
+                }
+                tail += numItems;
+                if (numStale < numItems) {
+                    mTail.store(tail, std::memory_order_release);
+                    return numItems - numStale;
+                }
+            }
+            mTail.store(tail, std::memory_order_release);
+            return 0;
+        }
+
+        /**
+         * Removes the oldest item. Consumer only.
+         * 
+         * @param[out] item Removed item.
+         * @return Whether there was an item to remove.
+         */
+        bool pop(T & item) { return pop(&item, 1) == 1; }
+
+        /** Removes every queued item. Consumer only. */
+        void discard(void) {
+            mTail.store(mHead.load(std::memory_order_acquire), std::memory_order_release);
+        }
+
+        /** Returns the number of queued items. A snapshot if called by either side. */
+        size_t size(void) const {
+            const uint32_t numItems = mHead.load(std::memory_order_acquire)
+                - mTail.load(std::memory_order_acquire);
+            return (numItems > N) ? N : numItems;
+        }
+
+        bool empty(void) const { return size() == 0; }
+
+        /**
+         * Returns the number of items overwritten before the consumer read
+         * them. Only counts overwrites the consumer has passed over.
+         */
+        uint32_t getDropped(void) const { return mDropped.load(std::memory_order_relaxed); }
+
+    private:
+        /** Counts overwritten items. Consumer only. */
+        void addDropped(const uint32_t numItems) {
+            mDropped.store(
+                mDropped.load(std::memory_order_relaxed) + numItems,
+                std::memory_order_relaxed);
+        }
+
+    private:
+        /** Item storage. Atomic so that a slot can be read while it is overwritten. */
+        std::atomic<T> mData[N];
+
+        /** Free running write counter, advanced by the producer. */
+        std::atomic<uint32_t> mHead;
+
+        /** One past the counter of the slot being written, set by the producer. */
+        std::atomic<uint32_t> mWriting;
+
+        /** Free running read counter, advanced by the consumer. */
+        std::atomic<uint32_t> mTail;
+
+        /** Number of overwritten items, written by the consumer. */
+        std::atomic<uint32_t> mDropped;
+};
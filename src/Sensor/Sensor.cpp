@@ -5,15 +5,16 @@
  * Author: Matthew Yu
  * Organization: UT Solar Vehicles Team
  * Created on: September 10th, 2020
- * Last Modified: 06/06/21
+ * Last Modified: 10/17/26
  * 
  * File Description: This file implements functions defined for the Sensor
  * class.
  */
 #include "Sensor.h"
 
-Sensor::Sensor() {
+Sensor::Sensor() : mSensorSem(1) {
     mSensorValue = 0.0;
+    mPending = false;
     mFilterType = FilterType::NONE;
 }
 
@@ -24,7 +25,38 @@ void Sensor::setFilter(const enum FilterType filterType, Filter * filter) {
 
 float Sensor::getValue(void) {
     mSensorSem.acquire();
+    drainSamples();
+    if (mPending) {
+        mSensorValue = mFilter->getResult();
+        mPending = false;
+    }
     float sensorValue = mSensorValue;
     mSensorSem.release();
     return sensorValue;
 }
+
+void Sensor::update(void) {
+    mSensorSem.acquire();
+    drainSamples();
+    mSensorSem.release();
+}
+
+uint32_t Sensor::getDroppedSamples(void) const { return mSamples.getDropped(); }
+
+void Sensor::resetFilter(void) {
+    mSensorSem.acquire();
+    mSamples.discard();
+    mFilter->clear();
+    mSensorValue = 0;
+    mPending = false;
+    mSensorSem.release();
+}
+
+void Sensor::drainSamples(void) {
+    float samples[SENSOR_QUEUE_SIZE];
+    size_t numSamples = mSamples.pop(samples, SENSOR_QUEUE_SIZE);
+    if (numSamples > 0) {
+        mFilter->addSamples(samples, numSamples);
+        mPending = true;
+    }
+}
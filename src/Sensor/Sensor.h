@@ -5,20 +5,41 @@
  * Author: Matthew Yu
  * Organization: UT Solar Vehicles Team
  * Created on: September 10th, 2020
- * Last Modified: 06/08/21
+ * Last Modified: 10/17/26
  * 
  * File Description: Describes the Sensor class, which is an InterruptDevice
  * that reads, filters, and calibrates ADC values for various applications.
+ * 
+ * The handler only pushes raw samples into a lock-free SampleQueue; it never
+ * touches the filter or an RTOS primitive, so no sample is lost to a consumer
+ * holding the lock. update drains the queue into the filter in batches
+ * through addSamples, and getValue does the same before computing the filter
+ * result. Expensive filter outputs are then evaluated in the consuming thread
+ * instead of the interrupt, and only when they are read.
+ * 
+ * The queue holds SENSOR_QUEUE_SIZE samples and overwrites the oldest when
+ * full, so a late reader still gets the newest samples. If every sample must
+ * reach the filter, call update from a thread or an EventQueue at least once
+ * every SENSOR_QUEUE_SIZE handler periods, i.e.
+ * 
+ *     queue.call_every(10ms, callback(&sensor, &Sensor::update));
  */
 #pragma once
 #include "mbed.h"
 #include <chrono>
 #include <src/Filter/Filter.h>
 #include <src/InterruptDevice/InterruptDevice.h>
+#include <src/SampleQueue/SampleQueue.h>
+
+/**
+ * Number of samples the handler can queue between drains. Must be a power of
+ * two.
+ */
+#define SENSOR_QUEUE_SIZE 64
 
 class Sensor : public InterruptDevice {
     public:
-        enum FilterType {NONE, EMA, SMA, MEDIAN, KALMAN};
+        enum FilterType {NONE, EMA, SMA, MEDIAN, KALMAN, CHAIN};
 
     public:
         /** Constructor for a sensor object. */
@@ -28,21 +49,42 @@ class Sensor : public InterruptDevice {
          * Sets the internal filter for the handler operation.
          * 
          * @param[in] filterType The filter being used.
-         * @param[in] filter Upcast reference to the filter.
+         * @param[in] filter Upcast reference to the filter. Use a FilterChain
+         *                   (FilterType CHAIN) to run several filters in
+         *                   series.
          * @note Deleting the filter will break the sensor if the FilterType is
          * not NONE.
          */
         void setFilter(const enum FilterType filterType, Filter * filter);
 
         /**
-         * Returns the latest value of the sensor, scaled appropriately.
+         * Returns the latest value of the sensor, scaled appropriately. If new
+         * samples arrived since the last call, they are filtered and the
+         * filter result is computed here.
          * 
-         * @note This method may stall until the lock on the variable is released, which
-         * means the sensor has uploaded the new value into it.
+         * @note This method may stall while another thread reads or clears
+         * the sensor. It never waits on the handler.
          * @return Sensor value.
          */
         float getValue(void);
 
+        /**
+         * Filters the samples queued by the handler without computing the
+         * result. Call it from a thread or an EventQueue, not an interrupt, so
+         * samples are filtered even if getValue is called rarely.
+         * 
+         * @note This method may stall while another thread reads or clears
+         * the sensor. It never waits on the handler.
+         */
+        void update(void);
+
+        /**
+         * Returns the number of samples overwritten before they were
+         * filtered, i.e. because neither update nor getValue was called for
+         * SENSOR_QUEUE_SIZE handler calls.
+         */
+        uint32_t getDroppedSamples(void) const;
+
         /** Resets the internal filter history and current sensor value. */
         virtual void clearHistory(void) = 0;
 
@@ -50,14 +92,36 @@ class Sensor : public InterruptDevice {
         /** Reads the sensor value and converts it into something usable. */
         virtual void handler(void) = 0;
 
+        /**
+         * Discards queued samples and resets the filter and current sensor
+         * value. Shared by the clearHistory implementations.
+         */
+        void resetFilter(void);
+
+    private:
+        /** Drains the queue into the filter. Call with mSensorSem held. */
+        void drainSamples(void);
+
     protected:
         /** Reference to the filter to insert data into. */
         Filter * mFilter;
         enum FilterType mFilterType;
 
-        /** Lock to prevent read/modification of shared resources. */
+        /**
+         * Lock between consumer threads for the filter and mSensorValue. The
+         * handler never takes it.
+         */
         Semaphore mSensorSem;
 
+        /** Raw samples from the handler, waiting to be filtered. */
+        SampleQueue<float, SENSOR_QUEUE_SIZE> mSamples;
+
         /** Sensor output result value. */
         float mSensorValue;
+
+        /**
+         * Whether the filter received samples that are not yet reflected in
+         * mSensorValue.
+         */
+        bool mPending;
 };
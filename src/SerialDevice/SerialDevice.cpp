@@ -5,7 +5,7 @@
  * Author: Matthew Yu
  * Organization: UT Solar Vehicles Team
  * Created on: September 27th, 2020
- * Last Modified: 06/08/21
+ * Last Modified: 10/17/26
  * 
  * File Description: This implementation file implements the SerialDevice class,
  * which is a concrete class that defines a clear read/write API for handling
@@ -24,15 +24,10 @@ SerialDevice::SerialDevice(
     const PinName txPin, 
     const PinName rxPin, 
     const uint16_t bufferSize,
-    const uint16_t baudRate) : mSerialPort(txPin, rxPin) {
+    const uint16_t baudRate) : mSerialPort(txPin, rxPin), mBuffer(bufferSize) {
     mSerialPort.set_baud(baudRate);
     mSerialPort.set_format(8, BufferedSerial::None, 1);
-    mBuffer = new char[bufferSize];
     mBufferSem = new Semaphore(1);
-    mTotalCapacity = bufferSize;
-    mUsedCapacity = 0;
-    mWriteIdx = 0;
-    mReadIdx = 0;
     readActivity = false;
 }
 
@@ -55,22 +50,14 @@ bool SerialDevice::getMessage(Message* message) {
     if (readActivity) {
         readActivity = false;
 
-        /* Read into a temporary buffer. This is a fixed size, since 
-           allocating a dynamic buffer is slow. */
-        #define MAX_BUF_ALLOC 16
-        char buf[MAX_BUF_ALLOC];
-        uint16_t freeCapacity = mTotalCapacity - mUsedCapacity;
-        freeCapacity = (freeCapacity > MAX_BUF_ALLOC) ? MAX_BUF_ALLOC : freeCapacity;
-        #undef MAX_BUF_ALLOC
-        ssize_t bytesRead = mSerialPort.read(buf, freeCapacity);
-        
-        /* Smartly put in the bytes into our actual buffer. */
-        if (bytesRead > 0) {
-            for (ssize_t i = 0; i < bytesRead; ++i) {
-                mBuffer[mWriteIdx] = buf[i];
-                mWriteIdx = (mWriteIdx + 1) % mTotalCapacity;
-            }
-            mUsedCapacity += bytesRead;
+        /* Read straight into the free space of our buffer, up to the point
+           where it wraps. */
+        RingSpan<char> space;
+        RingSpan<char> wrapped;
+        mBuffer.writeSpans(space, wrapped);
+        if (space.size > 0) {
+            ssize_t bytesRead = mSerialPort.read(space.data, space.size);
+            if (bytesRead > 0) { mBuffer.commit(bytesRead); }
         }
 
         /* The baseline message is in DeSeCa type 2 encoding, which consists of an
@@ -82,21 +69,15 @@ bool SerialDevice::getMessage(Message* message) {
            To see if we've received a message, we simply we need to check whether
            there are 12 bytes in the buffer that can be read. If there are, we
            decode the ID and DATA fields from it and insert into the message. */
-        if (mUsedCapacity >= T2MSG_BYTES_IN_MESSAGE) {
+        if (mBuffer.size() >= T2MSG_BYTES_IN_MESSAGE) {
             uint16_t id;
-            char idBuf[T2MSG_NUM_ID_BYTES] = {'\0'};
-            for (uint16_t i = 0; i < T2MSG_NUM_ID_BYTES; ++i) {
-                idBuf[i] = mBuffer[mReadIdx];
-                mReadIdx = (mReadIdx + 1) % mTotalCapacity;
-            }
+            char idBuf[T2MSG_NUM_ID_BYTES + 1] = {'\0'};
+            mBuffer.pop(idBuf, T2MSG_NUM_ID_BYTES);
             id = (uint16_t) strtoul (idBuf, NULL, 16);
             message->setMessageID(id);
 
             char buf[T2MSG_NUM_DATA_BYTES];
-            for (uint16_t i = 0; i < T2MSG_NUM_DATA_BYTES; ++i) {
-                buf[i] = mBuffer[mReadIdx];
-                mReadIdx = (mReadIdx + 1) % mTotalCapacity;
-            }
+            mBuffer.pop(buf, T2MSG_NUM_DATA_BYTES);
             message->setMessageDataC(buf, T2MSG_NUM_DATA_BYTES);
             result = true;
         }
@@ -107,15 +88,13 @@ bool SerialDevice::getMessage(Message* message) {
 
 void SerialDevice::purgeBuffer(void) {
     mBufferSem->acquire();
-    mUsedCapacity = 0; 
-    mWriteIdx = 0; 
-    mReadIdx = 0;
+    mBuffer.clear();
     readActivity = false;
     mBufferSem->release();
 }
 
 SerialDevice::~SerialDevice(void) { 
-    delete[] mBuffer;
+    mBuffer.release();
     delete mBufferSem;
 }
 
@@ -124,22 +103,12 @@ SerialDevice::~SerialDevice(void) {
 void SerialDevice::handler(void) {
     /* Early exit if we can't acquire the semaphore or the buffer is full. */
     if (!mBufferSem->try_acquire()) return;
-    if (!isBufferFull(mReadIdx, mWriteIdx)) {
+    if (!mBuffer.full()) {
         readActivity = true;
     }
     mBufferSem->release();
 }
 
-inline bool SerialDevice::isBufferFull(uint16_t readIdx, uint16_t writeIdx) {
-    if (readIdx == (writeIdx + 1) % mTotalCapacity) return true;
-    else return false;
-}
-
-inline bool SerialDevice::isBufferEmpty(uint16_t readIdx, uint16_t writeIdx) {
-    if (readIdx == writeIdx) return true;
-    else return false;
-}
-
 #undef T2MSG_BYTES_IN_MESSAGE
 #undef T2MSG_NUM_ID_BYTES
 #undef T2MSG_NUM_DATA_BYTES
\ No newline at end of file
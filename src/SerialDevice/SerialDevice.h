@@ -5,7 +5,7 @@
  * Author: Matthew Yu
  * Organization: UT Solar Vehicles Team
  * Created on: September 27th, 2020
- * Last Modified: 06/08/21
+ * Last Modified: 10/17/26
  * 
  * File Description: This header file describes the SerialDevice class, which is
  * a concrete class that defines a clear read/write API for handling
@@ -15,6 +15,7 @@
 #include "mbed.h"
 #include <src/InterruptDevice/InterruptDevice.h>
 #include <src/Message/Message.h>
+#include <src/RingBuffer/RingBuffer.h>
 
 /**
  * Definition of an implementation of serial communication using the mbed
@@ -22,7 +23,7 @@
  * 
  * The Serial class sets up a the serial communication and manages a buffer to
  * read and translate messages from the PC via USB. Data is captured on
- * interrupt from a BufferedSerial instance and stashed into a string buffer;
+ * interrupt from a BufferedSerial instance and stashed into a ring buffer;
  * this secondary buffer concatenates data into a single stream.
  * 
  * The caller can then asynchronously extract messages from the stream in order.
@@ -34,9 +35,9 @@ class SerialDevice final : public InterruptDevice {
          * 
          * @param[in] txPin Transceiver pin.
          * @param[in] rxPin Receiver pin.
-         * @param[in] bufferSize Size of the buffer (num chars stored).
+         * @param[in] bufferSize Size of the buffer (num chars stored). Rounded
+         *                       up to a power of two.
          * @param[in] baudRate Baudrate of the connection.
-         * @note bufferSize is ideally a multiple of 12 bytes (1 T2 message).
          */
         explicit SerialDevice(
             const PinName txPin, 
@@ -87,25 +88,13 @@ class SerialDevice final : public InterruptDevice {
         /** Reads the serial buffer and pushes it into the secondary buffer. */
         void handler(void) override;
 
-        inline bool isBufferFull(uint16_t readIdx, uint16_t writeIdx);
-        inline bool isBufferEmpty(uint16_t readIdx, uint16_t writeIdx);
-
     private:
         BufferedSerial mSerialPort;
 
-        /** Pointer to a buffer object that holds data. */
-        char *mBuffer;
-
-        /** Indices for writing/reading from a circular char buffer. */
-        uint16_t mWriteIdx;
-        uint16_t mReadIdx;
-
-        /** Capacity variables. */
-        uint16_t mTotalCapacity;
-        uint16_t mUsedCapacity;
+        /** Circular char buffer that holds received data. */
+        RingBuffer<char, 0> mBuffer;
         
-        /** mBufferSem should only be captured on the following: mUsedCapacity,
-            mWriteIdx, mReadIdx, mBuffer modification. */
+        /** mBufferSem should only be captured on mBuffer modification. */
         Semaphore *mBufferSem;
 
         bool readActivity;
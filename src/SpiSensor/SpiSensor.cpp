@@ -5,7 +5,7 @@
  * Author: Matthew Yu
  * Organization: UT Solar Vehicles Team
  * Created on: June 6th, 2021
- * Last Modified: 06/06/21
+ * Last Modified: 10/17/26
  * 
  * File Description: Describes the SpiSensor class, which is a derivative of the
  * Sensor class. It utilizes SPI.
@@ -17,7 +17,4 @@ SpiSensor::SpiSensor(
     const PinName miso, 
     const PinName sclk) : mSpiSensor(mosi, miso, sclk) {}
 
-void SpiSensor::clearHistory(void) {
-    mFilter->clear();
-    mSensorValue = 0;
-}
+void SpiSensor::clearHistory(void) { resetFilter(); }
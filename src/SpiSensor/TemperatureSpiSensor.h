@@ -5,7 +5,7 @@
  * Author: Matthew Yu
  * Organization: UT Solar Vehicles Team
  * Created on: September 10th, 2020
- * Last Modified: 06/08/21
+ * Last Modified: 10/17/26
  * 
  * File Description: This header file implements the TemperatureSpiSensor class,
  * which is derived from the SpiSensor class.
@@ -29,15 +29,11 @@ class TemperatureSpiSensor final : public SpiSensor {
 
     private:
         void handler(void) override {
-            if (!mSensorSem.try_acquire()) return;
-
             /** TODO: Send request to device to ask for data. */
 
             /** TODO: Capture response and translate. */
             float tempData = 0.0;
 
-            mFilter->addSample(tempData);
-            mSensorValue = mFilter->getResult();
-            mSensorSem.release();
+            mSamples.push(tempData);
         }
 };